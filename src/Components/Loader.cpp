@@ -47,6 +47,7 @@
 #include "Modules/RawFiles.hpp"
 #include "Modules/RawMouse.hpp"
 #include "Modules/RCon.hpp"
+#include "Modules/Resolver.hpp"
 #include "Modules/Rumble.hpp"
 #include "Modules/Security.hpp"
 #include "Modules/ServerCommands.hpp"
@@ -166,6 +167,7 @@ namespace Components
 		Register(new RawMouse());
 		Register(new RCon());
 		Register(new Renderer());
+		Register(new Resolver());
 		Register(new Scheduler());
 		Register(new Security());
 		Register(new ServerCommands());
@@ -1,6 +1,7 @@
 #include "Bots.hpp"
 #include "ClanTags.hpp"
 #include "Events.hpp"
+#include "Resolver.hpp"
 
 #include "GSC/Script.hpp"
 
@@ -19,6 +20,7 @@ namespace Components
 	const Game::dvar_t* Bots::sv_replaceBots;
 
 	std::size_t Bots::BotDataIndex;
+	int Bots::BotNameRetries = 0;
 
 	std::vector<Bots::botData> Bots::RemoteBotNames;
 
@@ -66,13 +68,22 @@ namespace Components
 
 	void Bots::UpdateBotNames()
 	{
-		const auto masterPort = (*Game::com_masterPort)->current.integer;
-		const auto* masterServerName = (*Game::com_masterServerName)->current.string;
+		const auto master = Resolver::GetMasterServer();
+		if (!master.has_value())
+		{
+			// Lookup is still in flight, ask again once it completed
+			if (++BotNameRetries <= 30)
+			{
+				Scheduler::Once(UpdateBotNames, Scheduler::Pipeline::MAIN, 1s);
+			}
 
-		Network::Address master(Utils::String::VA("%s:%u", masterServerName, masterPort));
+			return;
+		}
+
+		BotNameRetries = 0;
 
 		Logger::Print("Getting bots...\n");
-		Network::Send(master, "getbots");
+		Network::Send(*master, "getbots");
 	}
 
 	std::vector<Bots::botData> Bots::LoadBotNames()
@@ -672,11 +683,8 @@ namespace Components
 
 		Network::OnClientPacket("getbotsResponse", [](const Network::Address& address, const std::string& data)
 			{
-				const auto masterPort = (*Game::com_masterPort)->current.integer;
-				const auto* masterServerName = (*Game::com_masterServerName)->current.string;
-
-				Network::Address master(Utils::String::VA("%s:%u", masterServerName, masterPort));
-				if (master == address)
+				const auto master = Resolver::GetMasterServer();
+				if (master.has_value() && *master == address)
 				{
 					auto botNames = Utils::String::Split(data, '\n');
 					Logger::Print("Got {} names from the master server\n", botNames.size());
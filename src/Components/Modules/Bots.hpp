@@ -19,6 +19,7 @@ namespace Components
 		static const Game::dvar_t* sv_replaceBots;
 
 		static std::size_t BotDataIndex;
+		static int BotNameRetries;
 
 		static std::vector<botData> RemoteBotNames;
 
@@ -53,6 +53,11 @@ namespace Components
 
 	std::thread Console::ConsoleThread;
 
+	std::mutex Console::CursesMutex;
+	std::mutex Console::PendingMutex;
+	std::string Console::PendingOutput;
+	bool Console::StatusDirty = false;
+
 	Game::SafeArea Console::OriginalSafeArea;
 
 	bool Console::isCommand;
@@ -91,9 +96,15 @@ namespace Components
 				clientCount = Game::PartyHost_CountMembers(Game::g_lobbyData);
 			}
 
+			std::lock_guard _(CursesMutex);
+			if (!InfoWindow) return;
+
 			wclear(InfoWindow);
 			wprintw(InfoWindow, "%s : %d/%d players : map %s", hostname.data(), clientCount, maxClientCount, (!mapname.empty()) ? mapname.data() : "none");
 			wnoutrefresh(InfoWindow);
+
+			// The staged update goes out with the next repaint
+			StatusDirty = true;
 		}
 		else if (IsWindow(GetWindow()) != FALSE)
 		{
@@ -186,6 +197,8 @@ namespace Components
 
 	const char* Console::Input()
 	{
+		std::lock_guard _(CursesMutex);
+
 		if (!HasConsole)
 		{
 			ShowPrompt();
@@ -193,13 +206,6 @@ namespace Components
 			HasConsole = true;
 		}
 
-		auto currentTime = static_cast<int>(GetTickCount64()); // Make our compiler happy
-		if ((currentTime - LastRefresh) > 250)
-		{
-			RefreshOutput();
-			LastRefresh = currentTime;
-		}
-
 		auto c = wgetch(InputWindow);
 
 		if (c == ERR)
@@ -212,6 +218,9 @@ namespace Components
 		case '\r':
 		case 459: // keypad enter
 		{
+			// Keep the echoed command behind any output that is still queued
+			DrainOutput();
+
 			wattron(OutputWindow, COLOR_PAIR(10) | A_BOLD);
 			wprintw(OutputWindow, "%s", "]");
 
@@ -308,6 +317,8 @@ namespace Components
 
 	void Console::Destroy()
 	{
+		std::lock_guard _(CursesMutex);
+
 		__try
 		{
 			delwin(OutputWindow);
@@ -321,10 +332,15 @@ namespace Components
 		OutputWindow = nullptr;
 		InputWindow = nullptr;
 		InfoWindow = nullptr;
+
+		std::lock_guard pendingLock(PendingMutex);
+		PendingOutput.clear();
 	}
 
 	void Console::Create()
 	{
+		std::lock_guard _(CursesMutex);
+
 		OutputTop = 0;
 		OutBuffer = 0;
 		LastRefresh = 0;
@@ -391,7 +407,7 @@ namespace Components
 
 		Logger::PrintError(Game::CON_CHANNEL_ERROR, "{}\n", buf);
 
-		RefreshOutput();
+		FlushOutput();
 
 #ifdef _DEBUG
 		if (IsDebuggerPresent())
@@ -410,29 +426,98 @@ namespace Components
 	{
 		if (!OutputWindow) return;
 
-		const char* p = message;
-		while (*p != '\0')
+		// Only queue the text here, the curses work happens in RepaintOutput
+		std::lock_guard _(PendingMutex);
+
+		// Messages are kept null-separated so each one can reset the color afterwards
+		PendingOutput.append(message, std::strlen(message) + 1);
+
+		if (PendingOutput.size() > OUTPUT_PENDING_MAX)
 		{
-			if (*p == '^')
-			{
-				++p;
+			// Drop the oldest messages if the repaint can't keep up
+			const auto overflow = PendingOutput.size() - OUTPUT_PENDING_MAX;
+			const auto cut = PendingOutput.find('\0', overflow);
+			PendingOutput.erase(0, cut == std::string::npos ? PendingOutput.size() : cut + 1);
+		}
+	}
+
+	void Console::WriteOutput(const char* message, std::size_t length)
+	{
+		const auto* p = message;
+		const auto* end = message + length;
+		const auto* run = p;
 
-				const char color = (*p - '0');
+		while (p < end)
+		{
+			if (*p == '^' && p + 1 < end)
+			{
+				const char color = (p[1] - '0');
 				if (color < 9 && color > 0)
 				{
+					if (p > run)
+					{
+						waddnstr(OutputWindow, run, static_cast<int>(p - run));
+					}
+
 					wattron(OutputWindow, COLOR_PAIR(color + 2));
-					++p;
+					p += 2;
+					run = p;
 					continue;
 				}
 			}
 
-			waddch(OutputWindow, *p);
-
 			++p;
 		}
 
+		if (p > run)
+		{
+			waddnstr(OutputWindow, run, static_cast<int>(p - run));
+		}
+
 		wattron(OutputWindow, COLOR_PAIR(9));
+	}
+
+	bool Console::DrainOutput()
+	{
+		std::string pending;
 
+		{
+			std::lock_guard _(PendingMutex);
+			if (PendingOutput.empty()) return false;
+			pending.swap(PendingOutput);
+		}
+
+		std::size_t offset = 0;
+		while (offset < pending.size())
+		{
+			auto next = pending.find('\0', offset);
+			if (next == std::string::npos) next = pending.size();
+
+			WriteOutput(pending.data() + offset, next - offset);
+			offset = next + 1;
+		}
+
+		return true;
+	}
+
+	void Console::RepaintOutput()
+	{
+		std::lock_guard _(CursesMutex);
+		if (!OutputWindow) return;
+
+		if (DrainOutput() || StatusDirty)
+		{
+			RefreshOutput();
+			StatusDirty = false;
+		}
+	}
+
+	void Console::FlushOutput()
+	{
+		std::lock_guard _(CursesMutex);
+		if (!OutputWindow) return;
+
+		DrainOutput();
 		RefreshOutput();
 	}
 
@@ -696,8 +781,14 @@ namespace Components
 
 	void Console::StdOutPrint(const char* message)
 	{
-		printf("%s", message);
-		fflush(stdout);
+		// stdout is fully buffered and flushed periodically, see the constructor
+		std::fputs(message, stdout);
+
+		// Errors are printed in red, don't let them sit in the buffer in case we go down right after
+		if (message[0] == '^' && message[1] == '1')
+		{
+			std::fflush(stdout);
+		}
 	}
 
 	void Console::StdOutError(const char* fmt, ...)
@@ -709,6 +800,8 @@ namespace Components
 		vsnprintf_s(buffer, _TRUNCATE, fmt, ap);
 		va_end(ap);
 
+		std::fflush(stdout);
+
 		perror(buffer);
 		fflush(stderr);
 
@@ -916,8 +1009,20 @@ namespace Components
 		// External console
 		if (Flags::HasFlag("stdout"))
 		{
+			std::setvbuf(stdout, nullptr, _IOFBF, STDOUT_BUFFER_SIZE);
+
 			Utils::Hook(0x4B2080, StdOutPrint, HOOK_JUMP).install()->quick();
 			Utils::Hook(0x43D570, StdOutError, HOOK_JUMP).install()->quick();
+
+			Scheduler::Loop([]
+			{
+				std::fflush(stdout);
+			}, Scheduler::Pipeline::ASYNC, REPAINT_INTERVAL);
+
+			Scheduler::OnGameShutdown([]
+			{
+				std::fflush(stdout);
+			});
 		}
 		else if (Flags::HasFlag("console") || ZoneBuilder::IsEnabled()) // ZoneBuilder uses the game's console, until the native one is adapted.
 		{
@@ -965,6 +1070,10 @@ namespace Components
 			Utils::Hook(0x4B2080, Print, HOOK_JUMP).install()->quick();
 			Utils::Hook(0x43D570, Error, HOOK_JUMP).install()->quick();
 			Utils::Hook(0x4859A5, Input, HOOK_CALL).install()->quick();
+
+			Scheduler::Loop(RepaintOutput, Scheduler::Pipeline::ASYNC, REPAINT_INTERVAL);
+
+			Scheduler::OnGameShutdown(FlushOutput);
 		}
 		else
 		{
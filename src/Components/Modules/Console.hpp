@@ -3,6 +3,9 @@
 #define OUTPUT_HEIGHT 250
 #define OUTPUT_MAX_TOP (OUTPUT_HEIGHT - (Console::Height - 2))
 
+#define OUTPUT_PENDING_MAX (256 * 1024)
+#define STDOUT_BUFFER_SIZE (64 * 1024)
+
 namespace Components
 {
 	class Console : public Component
@@ -24,6 +27,8 @@ namespace Components
 		static constexpr int OUTPUT_BOX = 0x64;
 		static constexpr int INPUT_BOX = 0x65;
 
+		static constexpr std::chrono::milliseconds REPAINT_INTERVAL{50};
+
 		static int Width;
 		static int Height;
 
@@ -47,6 +52,11 @@ namespace Components
 
 		static std::thread ConsoleThread;
 
+		static std::mutex CursesMutex;
+		static std::mutex PendingMutex;
+		static std::string PendingOutput;
+		static bool StatusDirty;
+
 		static Game::SafeArea OriginalSafeArea;
 
 		static bool isCommand;
@@ -55,6 +65,10 @@ namespace Components
 		static void RefreshStatus();
 		static void RefreshOutput();
 		static void ScrollOutput(int amount);
+		static void WriteOutput(const char* message, std::size_t length);
+		static bool DrainOutput();
+		static void RepaintOutput();
+		static void FlushOutput();
 
 		static const char* Input();
 		static void Print(const char* message);
@@ -5,6 +5,7 @@
 #include "ClanTags.hpp"
 #include "Events.hpp"
 #include "Party.hpp"
+#include "Resolver.hpp"
 #include "ServerCommands.hpp"
 
 namespace Components
@@ -170,10 +171,28 @@ namespace Components
 		const auto masterPort = (*Game::com_masterPort)->current.unsignedInt;
 		const auto* masterServerName = (*Game::com_masterServerName)->current.string;
 
-		Network::Address master(Utils::String::VA("%s:%u", masterServerName, masterPort));
+		const auto master = Resolver::GetMasterServer();
+		if (!master.has_value())
+		{
+			// Lookup is still in flight, don't stall the frame waiting for it
+			static auto retryQueued = false;
+			if (!retryQueued)
+			{
+				Logger::Debug("Master server {}:{} is not resolved yet, retrying heartbeat shortly", masterServerName, masterPort);
+
+				retryQueued = true;
+				Scheduler::Once([]
+				{
+					retryQueued = false;
+					Heartbeat();
+				}, Scheduler::Pipeline::SERVER, 5s);
+			}
+
+			return;
+		}
 
 		Logger::Print("Sending heartbeat to master: {}:{}\n", masterServerName, masterPort);
-		Network::SendCommand(master, "heartbeat", "ZW3");
+		Network::SendCommand(*master, "heartbeat", "ZW3");
 	}
 
 	Dedicated::Dedicated()
@@ -73,7 +73,7 @@ namespace Components
 		if (!ipFetchInitiated)
 		{
 			ipFetchInitiated = true;
-			std::thread(FetchPublicIPAsync).detach();
+			Scheduler::Once(FetchPublicIPAsync, Scheduler::Pipeline::ASYNC_IO);
 		}
 
 		return "0.0.0.0";
@@ -158,7 +158,10 @@ namespace Components
 		if (Utils::IO::FileExists(path))
 		{
 			auto data = Utils::IO::ReadFile(path);
-			if (data.size() == file.size && Utils::String::DumpHex(Utils::Cryptography::SHA256::Compute(data), "") == file.hash)
+
+			// Compare the raw digests, the listed hash only has to be decoded once
+			std::string hash;
+			if (data.size() == file.size && Utils::Encoding::DecodeHex(file.hash, hash) && Utils::Cryptography::SHA256::Compute(data) == hash)
 			{
 				download->totalBytes_ += file.size;
 				return true;
@@ -507,8 +510,8 @@ namespace Components
 			return false;
 		}
 
-		const auto password = std::string(buffer, len);
-		if (password != Utils::String::DumpHex(Utils::Cryptography::SHA256::Compute(g_password), ""))
+		std::string password;
+		if (!Utils::Encoding::DecodeHex(std::string_view(buffer, len), password) || password != Utils::Cryptography::SHA256::Compute(g_password))
 		{
 			Download::ReplyError(c, 403, "Invalid Password");
 			return false;
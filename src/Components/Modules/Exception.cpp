@@ -256,6 +256,9 @@ namespace Components
 			return EXCEPTION_CONTINUE_EXECUTION;
 		}
 
+		// Write out buffered -stdout output, without the lock as the crashing thread might hold it
+		_fflush_nolock(stdout);
+
 		if (ExceptionInfo->ExceptionRecord->ExceptionCode == EXCEPTION_STACK_OVERFLOW)
 		{
 			const auto error = std::format("Termination because of a stack overflow.\n{}", CLIPBOARD_MSG);
@@ -1,6 +1,7 @@
 #include <zlib.h>
 
 #include "FastFiles.hpp"
+#include "TextRenderer.hpp"
 
 namespace Components
 {
@@ -14,9 +15,14 @@ namespace Components
 	bool FastFiles::StreamRead = false;
 
 	char FastFiles::LastByteRead = 0;
+	char FastFiles::DeobfuscationTable[256];
+
+	unsigned char FastFiles::BlockKeystream[8192];
+	bool FastFiles::BlockKeystreamValid = false;
 
 	unsigned int FastFiles::CurrentZone;
 	unsigned int FastFiles::MaxZones;
+	unsigned int FastFiles::UnloadGeneration = 0;
 
 	unsigned char FastFiles::ZoneKey[1191] =
 	{
@@ -435,6 +441,8 @@ namespace Components
 			ctr_start(aes, FastFiles::CurrentKey.iv, FastFiles::CurrentKey.key, sizeof(FastFiles::CurrentKey.key), 0, 0, &FastFiles::CurrentCTR);
 		}
 
+		FastFiles::BlockKeystreamValid = false;
+
 		Utils::Hook::Call<void()>(0x46FAE0)();
 	}
 
@@ -463,8 +471,23 @@ namespace Components
 	{
 		if (Zones::Version() >= 319)
 		{
-			ctr_setiv(FastFiles::CurrentKey.iv, sizeof(FastFiles::CurrentKey.iv), &FastFiles::CurrentCTR);
-			ctr_decrypt(buffer, buffer, 8192, &FastFiles::CurrentCTR);
+			// Every block restarts the counter at the zone IV, so the keystream is the same for all of them.
+			// Generate it once per zone and XOR it in instead of running AES over each block.
+			if (!FastFiles::BlockKeystreamValid)
+			{
+				std::memset(FastFiles::BlockKeystream, 0, sizeof(FastFiles::BlockKeystream));
+				ctr_setiv(FastFiles::CurrentKey.iv, sizeof(FastFiles::CurrentKey.iv), &FastFiles::CurrentCTR);
+				ctr_decrypt(FastFiles::BlockKeystream, FastFiles::BlockKeystream, sizeof(FastFiles::BlockKeystream), &FastFiles::CurrentCTR);
+				FastFiles::BlockKeystreamValid = true;
+			}
+
+			auto* block = reinterpret_cast<std::uint32_t*>(buffer);
+			const auto* keystream = reinterpret_cast<const std::uint32_t*>(FastFiles::BlockKeystream);
+
+			for (std::size_t i = 0; i < sizeof(FastFiles::BlockKeystream) / sizeof(std::uint32_t); ++i)
+			{
+				block[i] ^= keystream[i];
+			}
 		}
 	}
 
@@ -483,6 +506,11 @@ namespace Components
 		}
 	}
 
+	unsigned int FastFiles::GetUnloadGeneration()
+	{
+		return FastFiles::UnloadGeneration;
+	}
+
 	float FastFiles::GetFullLoadedFraction()
 	{
 		float singleProgress = 1.0f / FastFiles::MaxZones;
@@ -496,6 +524,18 @@ namespace Components
 		FastFiles::CurrentZone = 0;
 		FastFiles::MaxZones = zoneCount;
 
+		// Zones listed for unloading were just freed, and new ones may reuse their font addresses
+		TextRenderer::InvalidateTextWidthCache();
+
+		for (unsigned int i = 0; i < zoneCount; ++i)
+		{
+			if (zoneInfo[i].freeFlags)
+			{
+				++FastFiles::UnloadGeneration;
+				break;
+			}
+		}
+
 		Utils::Hook::Call<void(Game::XZoneInfo*, unsigned int)>(0x5BBAC0)(zoneInfo, zoneCount);
 	}
 
@@ -517,15 +557,29 @@ namespace Components
 
 		if (FastFiles::IsIW4xZone)
 		{
+			auto last = FastFiles::LastByteRead;
+
 			for (int i = 0; i < size; ++i)
 			{
-				buffer[i] ^= FastFiles::LastByteRead;
-				Utils::RotLeft(buffer[i], 4);
-				buffer[i] ^= -1;
-				Utils::RotRight(buffer[i], 6);
-
-				FastFiles::LastByteRead = buffer[i];
+				last = FastFiles::DeobfuscationTable[static_cast<unsigned char>(buffer[i] ^ last)];
+				buffer[i] = last;
 			}
+
+			FastFiles::LastByteRead = last;
+		}
+	}
+
+	void FastFiles::BuildDeobfuscationTable()
+	{
+		// The rotate/xor chain only depends on the byte after it was xored with the previous output
+		for (int i = 0; i < 256; ++i)
+		{
+			auto value = static_cast<char>(i);
+			Utils::RotLeft(value, 4);
+			value ^= -1;
+			Utils::RotRight(value, 6);
+
+			FastFiles::DeobfuscationTable[i] = value;
 		}
 	}
 
@@ -633,6 +687,7 @@ namespace Components
 		Utils::Hook(0x4157B8, FastFiles::ReadHeaderStub, HOOK_CALL).install()->quick();
 
 		// Obfuscate zone data
+		FastFiles::BuildDeobfuscationTable();
 		Utils::Hook(Game::DB_ReadXFile, FastFiles::ReadXFileStub, HOOK_JUMP).install()->quick();
 
 		// Allow custom zone loading
@@ -16,6 +16,9 @@ namespace Components
 
 		static float GetFullLoadedFraction();
 
+		// Bumped whenever zones are freed, anything holding asset pointers from before is suspect
+		static unsigned int GetUnloadGeneration();
+
 		static unsigned char ZoneKey[1191];
 
 		static symmetric_CTR CurrentCTR;
@@ -34,11 +37,16 @@ namespace Components
 
 		static unsigned int CurrentZone;
 		static unsigned int MaxZones;
+		static unsigned int UnloadGeneration;
 
 		static bool IsIW4xZone;
 		static bool StreamRead;
 
 		static char LastByteRead;
+		static char DeobfuscationTable[256];
+
+		static unsigned char BlockKeystream[8192];
+		static bool BlockKeystreamValid;
 
 		static Dvar::Var g_loadingInitialZones;
 
@@ -58,6 +66,7 @@ namespace Components
 		static int AuthLoadInflateCompare(unsigned char* buffer, int length, unsigned char* ivValue);
 		static void AuthLoadInflateDecryptBase();
 		static void AuthLoadInflateDecryptBaseFunc(unsigned char* buffer);
+		static void BuildDeobfuscationTable();
 
 		static void LoadZonesStub(Game::XZoneInfo *zoneInfo, unsigned int zoneCount);
 
@@ -234,91 +234,68 @@ namespace Components
 				{
 				}
 
-				std::unordered_set<std::wstring> legacySet;
-				std::vector<std::filesystem::path> allFiles;
-				const auto shouldDelete = [&](const std::filesystem::path& path, const std::filesystem::path& root) -> bool
-					{
-						const auto relative = path.lexically_relative(root).generic_string();
-						std::string relativeLower = relative;
-						std::transform(relativeLower.begin(), relativeLower.end(), relativeLower.begin(),
-							[](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
-						const auto filename = path.filename().string();
-						std::string filenameLower = filename;
-						std::transform(filenameLower.begin(), filenameLower.end(), filenameLower.begin(),
-							[](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
-
-						if (relativeLower == "zw3/zw3.iwd"
-							|| relativeLower == "zw3/zone/patch/patch_mp.ff"
-							|| relativeLower == "zw3/zone/english/zw3_common.ff")
-						{
-							return false;
-						}
-
-						if (relativeLower.size() >= 8 && relativeLower.rfind("zw3/", 0) == 0)
-						{
-							return false;
-						}
-
-						if (relativeLower == "iw4x/zw3.iwd"
-							|| relativeLower == "zw3.iwd"
-							|| relativeLower == "main/zw3.iwd"
-							|| relativeLower == "zone/patch/patch_mp.ff")
-						{
-							return true;
-						}
+				// Skip everything once this install layout has been cleaned
+				std::string layoutKey = "v1";
+				for (const auto& root : roots)
+				{
+					layoutKey += "|" + Utils::String::ToLower(root.generic_string());
+				}
 
-						if (path.extension() == ".iwd"
-							&& filenameLower.rfind("mp_", 0) == 0
-							&& path.parent_path().filename() == "main")
-						{
-							return true;
-						}
+				std::error_code markerError;
+				const auto markerPath = (std::filesystem::current_path(markerError) / "zw3" / "cleanup.marker").string();
+				if (Utils::IO::ReadFile(markerPath) == layoutKey)
+				{
+					return;
+				}
 
-						return false;
-					};
-				const auto collectLegacyInRoot = [&](const char* root)
+				// Only the known legacy locations are checked, instead of walking every file of the install
+				std::vector<std::filesystem::path> allFiles;
+				const auto collectLegacyInRoot = [&](const std::filesystem::path& baseDir)
 					{
-						if (root == nullptr || root[0] == '\0')
-						{
-							return;
-						}
-
 						std::error_code ec;
-						const auto baseDir = std::filesystem::path(root);
-						if (!std::filesystem::exists(baseDir, ec))
+						if (baseDir.empty() || !std::filesystem::is_directory(baseDir, ec))
 						{
 							return;
 						}
 
-						for (const auto& entry : std::filesystem::recursive_directory_iterator(baseDir, ec))
+						for (const auto* legacyFile : { "iw4x/zw3.iwd", "zw3.iwd", "main/zw3.iwd", "zone/patch/patch_mp.ff" })
 						{
-							if (ec)
+							const auto path = baseDir / legacyFile;
+							if (std::filesystem::is_regular_file(path, ec))
 							{
-								break;
+								allFiles.push_back(path);
 							}
+						}
 
+						// Old map packs were dropped straight into main
+						for (const auto& entry : std::filesystem::directory_iterator(baseDir / "main", ec))
+						{
 							if (!entry.is_regular_file(ec))
 							{
 								ec.clear();
 								continue;
 							}
 
-							const auto& path = entry.path();
-							allFiles.push_back(path);
-							if (shouldDelete(path, baseDir))
+							const auto filename = Utils::String::ToLower(entry.path().filename().string());
+							if (filename.starts_with("mp_") && filename.ends_with(".iwd"))
 							{
-								legacySet.insert(path.wstring());
+								allFiles.push_back(entry.path());
 							}
 						}
 					};
 
 				for (const auto& root : roots)
 				{
-					collectLegacyInRoot(root.string().c_str());
+					collectLegacyInRoot(root);
 				}
 
-				if (legacySet.empty())
+				// Both roots are usually the same directory
+				std::ranges::sort(allFiles);
+				allFiles.erase(std::ranges::unique(allFiles).begin(), allFiles.end());
+
+				if (allFiles.empty())
 				{
+					Utils::IO::WriteFile(markerPath, layoutKey);
 					return;
 				}
 
@@ -344,12 +321,6 @@ namespace Components
 						continue;
 					}
 
-					if (legacySet.find(path.wstring()) == legacySet.end())
-					{
-						++skippedCount;
-						continue;
-					}
-
 					const auto widePath = path.wstring();
 					SetFileAttributesW(widePath.c_str(), FILE_ATTRIBUTE_NORMAL);
 
@@ -394,6 +365,8 @@ namespace Components
 				}
 
 				progress.Close();
+				Utils::IO::WriteFile(markerPath, layoutKey);
+
 				MessageBoxA(nullptr,
 					Utils::String::Format("Cleanup complete.\n\nFiles checked: {}\nDeleted: {}\nSkipped: {}",
 						static_cast<int>(allFiles.size()),
@@ -12,6 +12,20 @@ namespace Components::GSC
 
 	std::filesystem::path IO::DefaultDestPath;
 
+	std::mutex IO::JobMutex;
+	std::condition_variable IO::JobCondition;
+	std::condition_variable IO::IdleCondition;
+	std::deque<IO::Job> IO::Jobs;
+	std::vector<IO::Completion> IO::Completions;
+	std::size_t IO::PendingAppendBytes = 0;
+	bool IO::FlushRequested = false;
+	bool IO::Busy = false;
+	bool IO::Terminate = false;
+	std::thread IO::Thread;
+
+	int IO::NextJobId = 0;
+	unsigned int IO::Generation = 0;
+
 	bool IO::ValidatePath(const char* function, const char* path)
 	{
 		for (std::size_t i = 0; i < std::extent_v<decltype(ForbiddenStrings)>; ++i)
@@ -120,6 +134,164 @@ namespace Components::GSC
 		openScriptIOFileHandle = nullptr;
 	}
 
+	int IO::QueueJob(JobType type, std::string path, std::string data)
+	{
+		std::lock_guard _(JobMutex);
+
+		// Consecutive appends to the same file are merged into a single write
+		if (type == JobType::BufferedAppend && !Jobs.empty() && Jobs.back().type == JobType::BufferedAppend && Jobs.back().path == path)
+		{
+			PendingAppendBytes += data.size();
+			Jobs.back().data.append(data);
+			if (PendingAppendBytes >= APPEND_FLUSH_SIZE) JobCondition.notify_one();
+			return Jobs.back().id;
+		}
+
+		const auto id = ++NextJobId;
+		if (type == JobType::BufferedAppend) PendingAppendBytes += data.size();
+
+		Jobs.push_back({ type, std::move(path), std::move(data), id, Generation });
+		JobCondition.notify_one();
+
+		return id;
+	}
+
+	void IO::Flush()
+	{
+		std::unique_lock lock(JobMutex);
+
+		FlushRequested = true;
+		JobCondition.notify_one();
+
+		IdleCondition.wait(lock, []
+		{
+			return Terminate || (Jobs.empty() && !Busy);
+		});
+
+		FlushRequested = false;
+	}
+
+	void IO::RunJob(const Job& job)
+	{
+		Completion completion{ job.id, job.generation, false, job.type == JobType::Read, {} };
+
+		switch (job.type)
+		{
+		case JobType::Write:
+		case JobType::Append:
+		case JobType::BufferedAppend:
+			completion.success = Utils::IO::WriteFile(job.path, job.data, job.type != JobType::Write);
+			break;
+		case JobType::Read:
+			completion.success = Utils::IO::ReadFile(job.path, &completion.data);
+			if (completion.data.size() >= (1 << 16))
+			{
+				completion.data.resize((1 << 16) - 1); // 65535 is the max string size for the SL system
+			}
+			break;
+		}
+
+		// Buffered appends have no script waiting on them
+		if (job.type == JobType::BufferedAppend)
+		{
+			if (!completion.success)
+			{
+				Logger::PrintError(Game::CON_CHANNEL_PARSERSCRIPT, "FileAppendBuffered: failed to write '{}'\n", job.path);
+			}
+
+			return;
+		}
+
+		std::lock_guard _(JobMutex);
+		Completions.emplace_back(std::move(completion));
+	}
+
+	void IO::Worker()
+	{
+		Com_InitThreadData();
+
+		std::unique_lock lock(JobMutex);
+
+		while (true)
+		{
+			JobCondition.wait(lock, []
+			{
+				return Terminate || !Jobs.empty();
+			});
+
+			if (Jobs.empty())
+			{
+				break; // Terminating with nothing left to write
+			}
+
+			// Hold back a lone buffered append for a moment so further appends can be merged into it
+			if (Jobs.size() == 1 && Jobs.front().type == JobType::BufferedAppend)
+			{
+				JobCondition.wait_for(lock, APPEND_FLUSH_DELAY, []
+				{
+					return Terminate || FlushRequested || Jobs.size() > 1 || PendingAppendBytes >= APPEND_FLUSH_SIZE;
+				});
+			}
+
+			auto job = std::move(Jobs.front());
+			Jobs.pop_front();
+
+			if (job.type == JobType::BufferedAppend)
+			{
+				PendingAppendBytes -= std::min(PendingAppendBytes, job.data.size());
+			}
+
+			Busy = true;
+			lock.unlock();
+
+			RunJob(job);
+
+			lock.lock();
+			Busy = false;
+
+			if (Jobs.empty())
+			{
+				IdleCondition.notify_all();
+			}
+		}
+
+		IdleCondition.notify_all();
+	}
+
+	void IO::NotifyCompletions()
+	{
+		std::vector<Completion> completions;
+
+		{
+			std::lock_guard _(JobMutex);
+			if (Completions.empty()) return;
+			completions.swap(Completions);
+		}
+
+		for (const auto& completion : completions)
+		{
+			// Results for a previous script VM have nobody waiting on them
+			if (completion.generation != Generation)
+			{
+				continue;
+			}
+
+			if (completion.isRead)
+			{
+				Game::Scr_AddString(completion.data.data());
+				Game::Scr_AddBool(completion.success);
+				Game::Scr_AddInt(completion.id);
+				Game::Scr_NotifyLevel(static_cast<std::uint16_t>(Game::SL_GetString("file_read", 0)), 3);
+			}
+			else
+			{
+				Game::Scr_AddBool(completion.success);
+				Game::Scr_AddInt(completion.id);
+				Game::Scr_NotifyLevel(static_cast<std::uint16_t>(Game::SL_GetString("file_write", 0)), 2);
+			}
+		}
+	}
+
 	void IO::AddScriptFunctions()
 	{
 		Script::AddFunction("FileWrite", [] // gsc: FileWrite(<filepath>, <string>, <mode>)
@@ -237,6 +409,58 @@ namespace Components::GSC
 			Game::Scr_AddInt(1);
 		});
 
+		Script::AddFunction("FileWriteAsync", [] // gsc: id = FileWriteAsync(<filepath>, <string>, <mode>); level waittill("file_write", id, success);
+		{
+			const auto* filepath = Game::Scr_GetString(0);
+			const auto* text = Game::Scr_GetString(1);
+			const auto* mode = Game::Scr_GetString(2);
+
+			if (!ValidatePath("FileWriteAsync", filepath))
+			{
+				Game::Scr_AddInt(-1);
+				return;
+			}
+
+			if (mode != "append"s && mode != "write"s)
+			{
+				Logger::Warning(Game::CON_CHANNEL_PARSERSCRIPT, "FileWriteAsync: mode not defined or was wrong, defaulting to 'write'\n");
+				mode = "write";
+			}
+
+			const auto append = mode == "append"s;
+			Game::Scr_AddInt(QueueJob(append ? JobType::Append : JobType::Write, BuildPath(filepath).string(), text));
+		});
+
+		Script::AddFunction("FileReadAsync", [] // gsc: id = FileReadAsync(<filepath>); level waittill("file_read", id, success, contents);
+		{
+			const auto* filepath = Game::Scr_GetString(0);
+			if (!ValidatePath("FileReadAsync", filepath))
+			{
+				Game::Scr_AddInt(-1);
+				return;
+			}
+
+			Game::Scr_AddInt(QueueJob(JobType::Read, BuildPath(filepath).string(), {}));
+		});
+
+		Script::AddFunction("FileAppendBuffered", [] // gsc: FileAppendBuffered(<filepath>, <string>)
+		{
+			const auto* filepath = Game::Scr_GetString(0);
+			const auto* text = Game::Scr_GetString(1);
+
+			if (!ValidatePath("FileAppendBuffered", filepath))
+			{
+				return;
+			}
+
+			QueueJob(JobType::BufferedAppend, BuildPath(filepath).string(), text);
+		});
+
+		Script::AddFunction("FileFlush", [] // gsc: FileFlush()
+		{
+			Flush();
+		});
+
 		Script::AddFunction("ReadStream", GScr_ReadStream);
 
 		Script::AddMethod("setanim", [](Game::scr_entref_t entref) // Usage: self setanim(<int>);
@@ -288,6 +512,34 @@ namespace Components::GSC
 				std::fclose(openScriptIOFileHandle);
 				openScriptIOFileHandle = nullptr;
 			}
+
+			// Make sure everything the scripts wrote is on disk before the next map starts
+			Flush();
+
+			std::lock_guard _(JobMutex);
+			Completions.clear();
+			++Generation;
 		});
+
+		Scheduler::Loop(NotifyCompletions, Scheduler::Pipeline::SERVER);
+
+		Terminate = false;
+		Thread = std::thread(Worker);
+	}
+
+	void IO::preDestroy()
+	{
+		{
+			std::lock_guard _(JobMutex);
+			Terminate = true;
+		}
+
+		JobCondition.notify_all();
+
+		// The worker drains the remaining writes before it exits
+		if (Thread.joinable())
+		{
+			Thread.join();
+		}
 	}
 }
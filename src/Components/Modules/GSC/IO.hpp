@@ -7,13 +7,58 @@ namespace Components::GSC
 	public:
 		IO();
 
+		void preDestroy() override;
+
 	private:
+		enum class JobType
+		{
+			Write,
+			Append,
+			BufferedAppend,
+			Read,
+		};
+
+		struct Job
+		{
+			JobType type;
+			std::string path;
+			std::string data;
+			int id;
+			unsigned int generation;
+		};
+
+		struct Completion
+		{
+			int id;
+			unsigned int generation;
+			bool success;
+			bool isRead;
+			std::string data;
+		};
+
+		static constexpr std::size_t APPEND_FLUSH_SIZE = 64 * 1024;
+		static constexpr std::chrono::milliseconds APPEND_FLUSH_DELAY = 250ms;
+
 		static const char* ForbiddenStrings[];
 
 		static FILE* openScriptIOFileHandle;
 
 		static std::filesystem::path DefaultDestPath;
 
+		static std::mutex JobMutex;
+		static std::condition_variable JobCondition;
+		static std::condition_variable IdleCondition;
+		static std::deque<Job> Jobs;
+		static std::vector<Completion> Completions;
+		static std::size_t PendingAppendBytes;
+		static bool FlushRequested;
+		static bool Busy;
+		static bool Terminate;
+		static std::thread Thread;
+
+		static int NextJobId;
+		static unsigned int Generation;
+
 		static bool ValidatePath(const char* function, const char* path);
 		static std::filesystem::path BuildPath(const char* path);
 
@@ -21,6 +66,12 @@ namespace Components::GSC
 		static void GScr_ReadStream();
 		static void GScr_CloseFile();
 
+		static int QueueJob(JobType type, std::string path, std::string data);
+		static void Flush();
+		static void RunJob(const Job& job);
+		static void Worker();
+		static void NotifyCompletions();
+
 		static void AddScriptFunctions();
 	};
 }
@@ -6,6 +6,263 @@ namespace Components::GSC
 {
 	std::unordered_map<std::string, std::string> ScriptStorage::Data;
 
+	std::string ScriptStorage::Journal;
+	bool ScriptStorage::JournalValid = false;
+	std::size_t ScriptStorage::FileSize = 0;
+
+	std::filesystem::path ScriptStorage::GetStoragePath()
+	{
+		return std::filesystem::path((*Game::fs_basepath)->current.string) / Game::fs_gamedir / Game::SCRIPTDATA_DIR / "scriptstorage.bin";
+	}
+
+	void ScriptStorage::AppendRecord(std::string& buffer, RecordType type, const std::string& key, const std::string& value)
+	{
+		// [type:1][keyLength:4][valueLength:4][key][value][checksum:4]
+		const auto start = buffer.size();
+		const auto keyLength = static_cast<std::uint32_t>(key.size());
+		const auto valueLength = static_cast<std::uint32_t>(value.size());
+
+		buffer.push_back(static_cast<char>(type));
+		buffer.append(reinterpret_cast<const char*>(&keyLength), sizeof(keyLength));
+		buffer.append(reinterpret_cast<const char*>(&valueLength), sizeof(valueLength));
+		buffer.append(key);
+		buffer.append(value);
+
+		const auto checksum = static_cast<std::uint32_t>(Utils::Cryptography::JenkinsOneAtATime::Compute(&buffer[start], buffer.size() - start));
+		buffer.append(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+	}
+
+	void ScriptStorage::Record(RecordType type, const std::string& key, const std::string& value)
+	{
+		if (!JournalValid)
+		{
+			return; // The next dump writes a full snapshot anyway
+		}
+
+		AppendRecord(Journal, type, key, value);
+
+		if (Journal.size() > JOURNAL_MAX_SIZE)
+		{
+			Journal.clear();
+			JournalValid = false;
+		}
+	}
+
+	bool ScriptStorage::ReadStorageFile(std::unordered_map<std::string, std::string>& data, std::size_t* validSize, std::size_t* fileSize)
+	{
+		std::string buffer;
+		if (!Utils::IO::ReadFile(GetStoragePath().string(), &buffer))
+		{
+			return false;
+		}
+
+		*fileSize = buffer.size();
+		*validSize = 0;
+
+		constexpr auto headerSize = sizeof(std::uint32_t) * 2;
+		if (buffer.size() < headerSize || *reinterpret_cast<const std::uint32_t*>(buffer.data()) != FILE_MAGIC
+			|| *reinterpret_cast<const std::uint32_t*>(buffer.data() + 4) != FILE_VERSION)
+		{
+			Logger::PrintError(Game::CON_CHANNEL_ERROR, "StorageLoad: {} is not a valid storage file\n", GetStoragePath().string());
+			return false;
+		}
+
+		constexpr auto recordOverhead = 1 + sizeof(std::uint32_t) * 3;
+		auto pos = headerSize;
+
+		// Replay the log, a torn or corrupt tail from a crash ends it
+		while (buffer.size() - pos >= recordOverhead)
+		{
+			const auto type = static_cast<RecordType>(buffer[pos]);
+			std::uint32_t keyLength, valueLength, checksum;
+			std::memcpy(&keyLength, &buffer[pos + 1], sizeof(keyLength));
+			std::memcpy(&valueLength, &buffer[pos + 5], sizeof(valueLength));
+
+			const auto payloadSize = 9ull + keyLength + valueLength;
+			if (buffer.size() - pos < payloadSize + sizeof(checksum))
+			{
+				break;
+			}
+
+			std::memcpy(&checksum, &buffer[pos + payloadSize], sizeof(checksum));
+			if (checksum != static_cast<std::uint32_t>(Utils::Cryptography::JenkinsOneAtATime::Compute(&buffer[pos], static_cast<std::size_t>(payloadSize))))
+			{
+				break;
+			}
+
+			std::string key(&buffer[pos + 9], keyLength);
+
+			if (type == RecordType::Set)
+			{
+				data.insert_or_assign(std::move(key), std::string(&buffer[pos + 9 + keyLength], valueLength));
+			}
+			else if (type == RecordType::Remove)
+			{
+				data.erase(key);
+			}
+			else if (type == RecordType::Clear)
+			{
+				data.clear();
+			}
+			else
+			{
+				break;
+			}
+
+			pos += static_cast<std::size_t>(payloadSize) + sizeof(checksum);
+		}
+
+		if (pos != buffer.size())
+		{
+			Logger::Warning(Game::CON_CHANNEL_SCRIPT, "StorageLoad: discarding {} bytes of incomplete records\n", buffer.size() - pos);
+		}
+
+		*validSize = pos;
+		return true;
+	}
+
+	bool ScriptStorage::WriteSnapshot()
+	{
+		std::string buffer;
+		buffer.append(reinterpret_cast<const char*>(&FILE_MAGIC), sizeof(FILE_MAGIC));
+		buffer.append(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+
+		for (const auto& [key, value] : Data)
+		{
+			AppendRecord(buffer, RecordType::Set, key, value);
+		}
+
+		// Write next to the store and swap it in, so a crash leaves either the old or the new file
+		const auto path = GetStoragePath();
+		auto temp = path;
+		temp += ".tmp";
+
+		if (!Utils::IO::WriteFile(temp.string(), buffer))
+		{
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp, path, ec);
+		if (ec)
+		{
+			Logger::PrintError(Game::CON_CHANNEL_ERROR, "StorageDump: failed to replace {}: {}\n", path.string(), ec.message());
+			return false;
+		}
+
+		FileSize = buffer.size();
+		Journal.clear();
+		JournalValid = true;
+
+		return true;
+	}
+
+	bool ScriptStorage::Dump()
+	{
+		if (JournalValid && Journal.empty())
+		{
+			return true;
+		}
+
+		if (JournalValid && FileSize + Journal.size() >= COMPACT_MIN_SIZE)
+		{
+			std::size_t liveSize = 0;
+			for (const auto& [key, value] : Data)
+			{
+				liveSize += key.size() + value.size() + 13;
+			}
+
+			// Compact once more than half of the log is dead records
+			if (FileSize + Journal.size() > liveSize * 2)
+			{
+				JournalValid = false;
+			}
+		}
+
+		if (JournalValid)
+		{
+			// Only append to the exact file we wrote, if it was deleted or changed behind our back a headerless or mismatched log would result
+			std::error_code ec;
+			const auto size = std::filesystem::file_size(GetStoragePath(), ec);
+			if (ec || size != FileSize)
+			{
+				JournalValid = false;
+			}
+		}
+
+		if (!JournalValid)
+		{
+			return WriteSnapshot();
+		}
+
+		if (!Utils::IO::WriteFile(GetStoragePath().string(), Journal, true))
+		{
+			return false;
+		}
+
+		FileSize += Journal.size();
+		Journal.clear();
+
+		return true;
+	}
+
+	void ScriptStorage::Load()
+	{
+		const auto wasEmpty = Data.empty();
+
+		std::unordered_map<std::string, std::string> loaded;
+		std::size_t validSize, fileSize;
+		if (!ReadStorageFile(loaded, &validSize, &fileSize))
+		{
+			// Pick up data stored by older versions
+			ImportJson();
+			return;
+		}
+
+		Data.merge(loaded);
+
+		// Appending stays valid only if memory now mirrors the file exactly
+		Journal.clear();
+		JournalValid = wasEmpty && validSize == fileSize;
+		FileSize = validSize;
+	}
+
+	// StorageDump no longer writes scriptstorage.json, tools reading it need StorageExportJson to be called
+	void ScriptStorage::ExportJson()
+	{
+		const nlohmann::json json = Data;
+
+		FileSystem::FileWriter(Game::SCRIPTDATA_DIR + "/scriptstorage.json"s).write(json.dump());
+	}
+
+	void ScriptStorage::ImportJson()
+	{
+		FileSystem::File storageFile(Game::SCRIPTDATA_DIR + "/scriptstorage.json"s);
+		if (!storageFile.exists())
+		{
+			return;
+		}
+
+		const auto& buffer = storageFile.getBuffer();
+		try
+		{
+			const nlohmann::json storageDef = nlohmann::json::parse(buffer);
+			const auto& newData = storageDef.get<std::unordered_map<std::string, std::string>>();
+
+			for (const auto& [key, value] : newData)
+			{
+				if (Data.emplace(key, value).second)
+				{
+					Record(RecordType::Set, key, value);
+				}
+			}
+		}
+		catch (const std::exception& ex)
+		{
+			Logger::PrintError(Game::CON_CHANNEL_ERROR, "JSON Parse Error: {}. File {} is invalid\n", ex.what(), storageFile.getName());
+		}
+	}
+
 	void ScriptStorage::AddScriptFunctions()
 	{
 		Script::AddFunction("StorageSet", [] // gsc: StorageSet(<str key>, <str data>);
@@ -20,6 +277,7 @@ namespace Components::GSC
 			}
 
 			Data.insert_or_assign(key, value);
+			Record(RecordType::Set, key, value);
 		});
 
 		Script::AddFunction("StorageRemove", [] // gsc: StorageRemove(<str key>);
@@ -39,6 +297,7 @@ namespace Components::GSC
 			}
 
 			Data.erase(key);
+			Record(RecordType::Remove, key);
 		});
 
 		Script::AddFunction("StorageGet", [] // gsc: StorageGet(<str key>);
@@ -81,35 +340,31 @@ namespace Components::GSC
 				return;
 			}
 
-			const nlohmann::json json = Data;
-
-			FileSystem::FileWriter(Game::SCRIPTDATA_DIR + "/scriptstorage.json"s).write(json.dump());
+			if (!Dump())
+			{
+				Logger::PrintError(Game::CON_CHANNEL_ERROR, "StorageDump: failed to write {}\n", GetStoragePath().string());
+			}
 		});
 
 		Script::AddFunction("StorageLoad", [] // gsc: StorageLoad();
 		{
-			FileSystem::File storageFile(Game::SCRIPTDATA_DIR + "/scriptstorage.json"s);
-			if (!storageFile.exists())
-			{
-				return;
-			}
+			Load();
+		});
 
-			const auto& buffer = storageFile.getBuffer();
-			try
-			{
-				const nlohmann::json storageDef = nlohmann::json::parse(buffer);
-				const auto& newData = storageDef.get<std::unordered_map<std::string, std::string>>();
-				Data.insert(newData.begin(), newData.end());
-			}
-			catch (const std::exception& ex)
-			{
-				Logger::PrintError(Game::CON_CHANNEL_ERROR, "JSON Parse Error: {}. File {} is invalid\n", ex.what(), storageFile.getName());
-			}
+		Script::AddFunction("StorageExportJson", [] // gsc: StorageExportJson();
+		{
+			ExportJson();
+		});
+
+		Script::AddFunction("StorageImportJson", [] // gsc: StorageImportJson();
+		{
+			ImportJson();
 		});
 
 		Script::AddFunction("StorageClear", [] // gsc: StorageClear();
 		{
 			Data.clear();
+			Record(RecordType::Clear);
 		});
 	}
 
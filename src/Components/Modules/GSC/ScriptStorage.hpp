@@ -8,8 +8,39 @@ namespace Components::GSC
 		ScriptStorage();
 
 	private:
+		enum class RecordType : std::uint8_t
+		{
+			Set = 1,
+			Remove = 2,
+			Clear = 3,
+		};
+
+		static constexpr std::uint32_t FILE_MAGIC = 0x52545347; // GSTR
+		static constexpr std::uint32_t FILE_VERSION = 1;
+		static constexpr std::size_t COMPACT_MIN_SIZE = 1024 * 1024;
+		static constexpr std::size_t JOURNAL_MAX_SIZE = 4 * 1024 * 1024;
+
 		static std::unordered_map<std::string, std::string> Data;
 
+		// Records not yet appended to the storage file
+		static std::string Journal;
+		// When false the file no longer mirrors Data + Journal and the next dump rewrites it
+		static bool JournalValid;
+		static std::size_t FileSize;
+
+		static std::filesystem::path GetStoragePath();
+
+		static void AppendRecord(std::string& buffer, RecordType type, const std::string& key, const std::string& value);
+		static void Record(RecordType type, const std::string& key = {}, const std::string& value = {});
+
+		static bool ReadStorageFile(std::unordered_map<std::string, std::string>& data, std::size_t* validSize, std::size_t* fileSize);
+		static bool WriteSnapshot();
+		static bool Dump();
+		static void Load();
+
+		static void ExportJson();
+		static void ImportJson();
+
 		static void AddScriptFunctions();
 	};
 }
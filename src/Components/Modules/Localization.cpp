@@ -4,7 +4,9 @@ namespace Components
 {
 	std::recursive_mutex Localization::LocalizeMutex;
 	Dvar::Var Localization::UseLocalization;
-	std::unordered_map<std::string, Game::LocalizeEntry*> Localization::LocalizeMap;
+	Localization::LocalizeTable Localization::LocalizeMap;
+	std::atomic<std::shared_ptr<const Localization::LocalizeTable>> Localization::LocalizeSnapshot;
+	std::atomic<bool> Localization::LocalizeSnapshotDirty = false;
 
 	std::optional<std::string> Localization::PrefixOverride;
 	std::function<void(Game::LocalizeEntry*)> Localization::ParseCallback;
@@ -20,9 +22,10 @@ namespace Components
 			key.insert(0, PrefixOverride.value());
 		}
 
-		if (LocalizeMap.contains(key))
+		if (const auto itr = LocalizeMap.find(key); itr != LocalizeMap.end())
 		{
-			auto* entry = LocalizeMap[key];
+			// Readers share the entry with the snapshot, updating it in place needs no republish
+			auto* entry = itr->second;
 
 			const auto* newStaticValue = allocator->duplicateString(psNewString);
 			if (!newStaticValue) return;
@@ -56,23 +59,54 @@ namespace Components
 		SaveParseOutput(entry);
 
 		LocalizeMap[key] = entry;
+
+		// New keys are published once per frame, so loading a whole language file only copies the table once
+		LocalizeSnapshotDirty = true;
 	}
 
-	const char* Localization::Get(const char* key)
+	void Localization::PublishSnapshot()
 	{
-		if (!UseLocalization.get<bool>()) return key;
+		if (!LocalizeSnapshotDirty) return;
+
+		std::lock_guard _(LocalizeMutex);
+
+		LocalizeSnapshot = std::make_shared<const LocalizeTable>(LocalizeMap);
+		LocalizeSnapshotDirty = false;
+	}
 
-		Game::LocalizeEntry* entry = nullptr;
+	Game::LocalizeEntry* Localization::Find(const std::string_view key)
+	{
+		// Read before the snapshot, a publish in between then still sends us to the live table
+		const bool dirty = LocalizeSnapshotDirty;
+
+		if (const auto snapshot = LocalizeSnapshot.load())
+		{
+			if (const auto itr = snapshot->find(key); itr != snapshot->end())
+			{
+				return itr->second;
+			}
+		}
 
+		// Keys added since the last publish are only in the live table
+		if (dirty)
 		{
 			std::lock_guard _(LocalizeMutex);
 
-			if (LocalizeMap.contains(key))
+			if (const auto itr = LocalizeMap.find(key); itr != LocalizeMap.end())
 			{
-				entry = LocalizeMap[key];
+				return itr->second;
 			}
 		}
 
+		return nullptr;
+	}
+
+	const char* Localization::Get(const char* key)
+	{
+		if (!UseLocalization.get<bool>()) return key;
+
+		auto* entry = Find(key);
+
 		if (!entry || !entry->value)
 		{
 			entry = Game::DB_FindXAssetHeader(Game::XAssetType::ASSET_TYPE_LOCALIZE_ENTRY, key).localize;
@@ -357,13 +391,7 @@ namespace Components
 		AssetHandler::OnFind(Game::XAssetType::ASSET_TYPE_LOCALIZE_ENTRY, [](Game::XAssetType, const std::string& name)
 		{
 			Game::XAssetHeader header = { nullptr };
-			std::lock_guard _(LocalizeMutex);
-
-			if (const auto itr = LocalizeMap.find(name); itr != LocalizeMap.end())
-			{
-				header.localize = itr->second;
-			}
-
+			header.localize = Find(name);
 			return header;
 		});
 
@@ -373,6 +401,8 @@ namespace Components
 		// Overwrite SetString
 		Utils::Hook(0x4CE5EE, SetStringStub, HOOK_CALL).install()->quick();
 
+		Scheduler::Loop(PublishSnapshot, Scheduler::Pipeline::MAIN);
+
 		Utils::Hook(0x49D4A0, SEH_LocalizeTextMessageStub, HOOK_JUMP).install()->quick();
 		Utils::Hook::Nop(0x49D4A5, 1);
 
@@ -400,6 +430,7 @@ namespace Components
 
 	Localization::~Localization()
 	{
+		LocalizeSnapshot = nullptr;
 		LocalizeMap.clear();
 	}
 }
@@ -17,8 +17,23 @@ namespace Components
 		static const char* LocalizeMapName(const char* mapName);
 
 	private:
+		struct KeyHash
+		{
+			using is_transparent = void;
+
+			std::size_t operator()(const std::string_view key) const noexcept
+			{
+				return std::hash<std::string_view>()(key);
+			}
+		};
+
+		// Heterogeneous lookup, so readers can search with a std::string_view without allocating
+		using LocalizeTable = std::unordered_map<std::string, Game::LocalizeEntry*, KeyHash, std::equal_to<>>;
+
 		static std::recursive_mutex LocalizeMutex;
-		static std::unordered_map<std::string, Game::LocalizeEntry*> LocalizeMap;
+		static LocalizeTable LocalizeMap;
+		static std::atomic<std::shared_ptr<const LocalizeTable>> LocalizeSnapshot;
+		static std::atomic<bool> LocalizeSnapshotDirty;
 		static Dvar::Var UseLocalization;
 
 		static std::function<void(Game::LocalizeEntry*)> ParseCallback;
@@ -27,6 +42,9 @@ namespace Components
 
 		static void SaveParseOutput(Game::LocalizeEntry* asset);
 
+		static void PublishSnapshot();
+		static Game::LocalizeEntry* Find(std::string_view key);
+
 		static void SetCredits();
 
 		static const char* SEH_LocalizeTextMessageStub(const char* pszInputBuffer, const char* pszMessageType, Game::msgLocErrType_t errType);
@@ -1,5 +1,9 @@
 #include "MapDump.hpp"
 
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 namespace Components
 {
 	class MapDumper
@@ -9,17 +13,25 @@ namespace Components
 		{
 		}
 
-		void dump()
+		void dump(const bool binary)
 		{
 			if (!this->world_) return;
 
 			Logger::Print("Exporting '{}'...\n", this->world_->baseName);
 
+			this->reserve();
 			this->parseVertices();
 			this->parseFaces();
 			this->parseStaticModels();
 
-			this->write();
+			if (binary)
+			{
+				this->writeBinary();
+			}
+			else
+			{
+				this->write();
+			}
 		}
 
 	private:
@@ -47,10 +59,10 @@ namespace Components
 		public:
 			File() {}
 
-			File(const std::string& file)
+			File(const std::string& file, const bool binary = false)
 			{
 				Utils::IO::WriteFile(file, {});
-				this->stream_ = std::ofstream(file, std::ofstream::out);
+				this->stream_ = std::ofstream(file, binary ? std::ofstream::out | std::ofstream::binary : std::ofstream::out);
 			}
 
 			void append(const std::string& str)
@@ -62,6 +74,51 @@ namespace Components
 			std::ofstream stream_{};
 		};
 
+		// Items are formatted in blocks across worker threads and written in order, so text output never has to be held in full
+		static constexpr std::size_t FORMAT_BLOCK_SIZE = 0x10000;
+
+		template <typename T, typename F>
+		static void AppendFormatted(File& file, const std::vector<T>& items, const F& format)
+		{
+			const auto workerCount = std::max(1u, std::thread::hardware_concurrency());
+
+			for (std::size_t begin = 0; begin < items.size(); begin += FORMAT_BLOCK_SIZE * workerCount)
+			{
+				std::vector<std::string> chunks(workerCount);
+				std::vector<std::thread> workers;
+
+				for (unsigned int worker = 0; worker < workerCount; ++worker)
+				{
+					const auto first = begin + worker * FORMAT_BLOCK_SIZE;
+					if (first >= items.size()) break;
+
+					const auto last = std::min(first + FORMAT_BLOCK_SIZE, items.size());
+					workers.emplace_back([&, first, last, worker]
+					{
+						auto& out = chunks[worker];
+						out.reserve((last - first) * 64);
+
+						char line[128];
+						for (auto i = first; i < last; ++i)
+						{
+							const auto length = format(items[i], line, sizeof(line));
+							out.append(line, static_cast<std::size_t>(std::max(0, std::min(length, static_cast<int>(sizeof(line)) - 1))));
+						}
+					});
+				}
+
+				for (auto& worker : workers)
+				{
+					worker.join();
+				}
+
+				for (const auto& chunk : chunks)
+				{
+					file.append(chunk);
+				}
+			}
+		}
+
 		Game::GfxWorld* world_{};
 		std::vector<Vertex> vertices_{};
 		std::unordered_map<Game::Material*, FaceList> faces_{};
@@ -76,6 +133,24 @@ namespace Components
 			std::swap(vec[1], vec[2]);
 		}
 
+		void reserve()
+		{
+			auto vertexCount = static_cast<std::size_t>(this->world_->draw.vertexCount);
+
+			for (unsigned int i = 0; i < this->world_->dpvs.smodelCount; ++i)
+			{
+				const auto* model = this->world_->dpvs.smodelDrawInsts[i].model;
+				const auto* lod = &model->lodInfo[model->numLods - 1];
+
+				for (unsigned short j = 0; j < lod->modelSurfs->numsurfs; ++j)
+				{
+					vertexCount += lod->modelSurfs->surfs[j].vertCount;
+				}
+			}
+
+			this->vertices_.reserve(vertexCount);
+		}
+
 		void parseVertices()
 		{
 			Logger::Print("Parsing vertices...\n");
@@ -105,6 +180,22 @@ namespace Components
 		{
 			Logger::Print("Parsing faces...\n");
 
+			// Size every face list up front instead of growing them one triangle at a time
+			std::unordered_map<Game::Material*, std::size_t> triCounts;
+			for (unsigned int i = 0; i < this->world_->dpvs.staticSurfaceCount; ++i)
+			{
+				const auto* surface = &this->world_->dpvs.surfaces[i];
+				if (this->findImage(surface->material, "colorMap")->mapType == 5) continue;
+
+				this->getFaceList(surface->material);
+				triCounts[surface->material] += surface->tris.triCount;
+			}
+
+			for (const auto& [material, count] : triCounts)
+			{
+				this->getFaceList(material).indices.reserve(count);
+			}
+
 			for (unsigned int i = 0; i < this->world_->dpvs.staticSurfaceCount; ++i)
 			{
 				const auto* surface = &this->world_->dpvs.surfaces[i];
@@ -155,6 +246,7 @@ namespace Components
 		std::vector<Vertex> parseSurfaceVertices(const Game::XSurface* surface, const Game::GfxPackedPlacement& placement)
 		{
 			std::vector<Vertex> vertices;
+			vertices.reserve(surface->vertCount);
 
 			for (unsigned short j = 0; j < surface->vertCount; j++)
 			{
@@ -186,6 +278,7 @@ namespace Components
 		std::vector<Face> parseSurfaceFaces(const Game::XSurface* surface) const
 		{
 			std::vector<Face> faces;
+			faces.reserve(surface->triCount);
 
 			for (unsigned short j = 0; j < surface->triCount; ++j)
 			{
@@ -200,37 +293,31 @@ namespace Components
 			return faces;
 		}
 
-		void removeVertex(const int index, std::vector<Face>& faces, std::vector<Vertex>& vertices) const
+		// Drops unreferenced vertices while keeping the order of the rest, in a single pass
+		void filterSurfaceVertices(std::vector<Face>& faces, std::vector<Vertex>& vertices) const
 		{
-			vertices.erase(vertices.begin() + index);
-
-			for (auto &face : faces)
+			std::vector<int> remap(vertices.size(), -1);
+			for (const auto& face : faces)
 			{
-				if (face.a > index) --face.a;
-				if (face.b > index) --face.b;
-				if (face.c > index) --face.c;
+				remap[face.a] = remap[face.b] = remap[face.c] = 0;
 			}
-		}
 
-		void filterSurfaceVertices(std::vector<Face>& faces, std::vector<Vertex>& vertices) const
-		{
-			for (auto i = 0; i < int(vertices.size()); ++i)
+			auto count = 0;
+			for (auto i = 0; i < static_cast<int>(vertices.size()); ++i)
 			{
-				auto referenced = false;
+				if (remap[i] < 0) continue;
 
-				for (const auto &face : faces)
-				{
-					if (face.a == i || face.b == i || face.c == i)
-					{
-						referenced = true;
-						break;
-					}
-				}
+				remap[i] = count;
+				vertices[count++] = vertices[i];
+			}
 
-				if (!referenced)
-				{
-					this->removeVertex(i--, faces, vertices);
-				}
+			vertices.resize(count);
+
+			for (auto& face : faces)
+			{
+				face.a = remap[face.a];
+				face.b = remap[face.b];
+				face.c = remap[face.c];
 			}
 		}
 
@@ -259,10 +346,7 @@ namespace Components
 
 				auto& f = this->getFaceList(model->model->materialHandles[i + surfIndex]);
 
-				for (const auto& vertex : vertices)
-				{
-					this->vertices_.push_back(vertex);
-				}
+				this->vertices_.insert(this->vertices_.end(), vertices.begin(), vertices.end());
 
 				for (auto face : faces)
 				{
@@ -311,26 +395,26 @@ namespace Components
 			Logger::Print("Writing vertices...\n");
 			this->object_.append("# Vertices\n");
 
-			for (const auto& vertex : this->vertices_)
+			AppendFormatted(this->object_, this->vertices_, [](const Vertex& vertex, char* line, const std::size_t size)
 			{
-				this->object_.append(Utils::String::VA("v %.6f %.6f %.6f\n", vertex.coordinate[0], vertex.coordinate[1], vertex.coordinate[2]));
-			}
+				return std::snprintf(line, size, "v %.6f %.6f %.6f\n", vertex.coordinate[0], vertex.coordinate[1], vertex.coordinate[2]);
+			});
 
 			Logger::Print("Writing texture coordinates...\n");
 			this->object_.append("\n# Texture coordinates\n");
 
-			for (const auto& vertex : this->vertices_)
+			AppendFormatted(this->object_, this->vertices_, [](const Vertex& vertex, char* line, const std::size_t size)
 			{
-				this->object_.append(Utils::String::VA("vt %.6f %.6f\n", vertex.texture[0], vertex.texture[1]));
-			}
+				return std::snprintf(line, size, "vt %.6f %.6f\n", vertex.texture[0], vertex.texture[1]);
+			});
 
 			Logger::Print("Writing normals...\n");
 			this->object_.append("\n# Normals\n");
 
-			for (const auto& vertex : this->vertices_)
+			AppendFormatted(this->object_, this->vertices_, [](const Vertex& vertex, char* line, const std::size_t size)
 			{
-				this->object_.append(Utils::String::VA("vn %.6f %.6f %.6f\n", vertex.normal[0], vertex.normal[1], vertex.normal[2]));
-			}
+				return std::snprintf(line, size, "vn %.6f %.6f %.6f\n", vertex.normal[0], vertex.normal[1], vertex.normal[2]);
+			});
 
 			this->object_.append("\n");
 		}
@@ -368,7 +452,7 @@ namespace Components
 			return image;
 		}
 
-		void writeMaterial(Game::Material* material)
+		std::string getMaterialName(const Game::Material* material) const
 		{
 			std::string name = material->info.name;
 
@@ -378,6 +462,13 @@ namespace Components
 				name = name.substr(pos + 1);
 			}
 
+			return name;
+		}
+
+		void writeMaterial(Game::Material* material)
+		{
+			const auto name = this->getMaterialName(material);
+
 			this->object_.append(Utils::String::VA("usemtl %s\n", name.data()));
 			this->object_.append("s off\n");
 
@@ -417,23 +508,253 @@ namespace Components
 				this->writeMaterial(material);
 
 				const auto& faces = this->getFaceList(material);
-				for (const auto& index : faces.indices)
+				AppendFormatted(this->object_, faces.indices, [](const Face& index, char* line, const std::size_t size)
 				{
 					const int a = index.a;
 					const int b = index.b;
 					const int c = index.c;
 
-					this->object_.append(Utils::String::VA("f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, b, b, b, c, c, c));
-				}
+					return std::snprintf(line, size, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, b, b, b, c, c, c);
+				});
 
 				this->object_.append("\n");
 			}
 		}
+
+		// Binary glTF: one mesh sharing a single vertex buffer, one primitive per material, textures referenced next to the file
+		void writeBinary()
+		{
+			Logger::Print("Writing binary glTF...\n");
+			Utils::IO::CreateDir(Utils::String::VA("raw/mapdump/%s/textures", this->world_->baseName));
+
+			constexpr auto GLTF_ARRAY_BUFFER = 34962;
+			constexpr auto GLTF_ELEMENT_ARRAY_BUFFER = 34963;
+			constexpr auto GLTF_FLOAT = 5126;
+			constexpr auto GLTF_UNSIGNED_INT = 5125;
+
+			rapidjson::Document document(rapidjson::kObjectType);
+			auto& allocator = document.GetAllocator();
+
+			rapidjson::Value bufferViews(rapidjson::kArrayType);
+			rapidjson::Value accessors(rapidjson::kArrayType);
+			rapidjson::Value primitives(rapidjson::kArrayType);
+			rapidjson::Value materials(rapidjson::kArrayType);
+			rapidjson::Value textures(rapidjson::kArrayType);
+			rapidjson::Value images(rapidjson::kArrayType);
+
+			std::string bin;
+			bin.reserve(this->vertices_.size() * sizeof(Vertex));
+
+			const auto addView = [&](const std::size_t offset, const int target)
+			{
+				rapidjson::Value view(rapidjson::kObjectType);
+				view.AddMember("buffer", 0, allocator);
+				view.AddMember("byteOffset", static_cast<std::uint64_t>(offset), allocator);
+				view.AddMember("byteLength", static_cast<std::uint64_t>(bin.size() - offset), allocator);
+				view.AddMember("target", target, allocator);
+				bufferViews.PushBack(view, allocator);
+				return bufferViews.Size() - 1;
+			};
+
+			const auto addAccessor = [&](const unsigned int view, const int componentType, const std::size_t count, const char* type) -> rapidjson::Value&
+			{
+				rapidjson::Value accessor(rapidjson::kObjectType);
+				accessor.AddMember("bufferView", view, allocator);
+				accessor.AddMember("componentType", componentType, allocator);
+				accessor.AddMember("count", static_cast<std::uint64_t>(count), allocator);
+				accessor.AddMember("type", rapidjson::StringRef(type), allocator);
+				accessors.PushBack(accessor, allocator);
+				return accessors[accessors.Size() - 1];
+			};
+
+			const auto addImage = [&](const Game::GfxImage* image)
+			{
+				rapidjson::Value imageValue(rapidjson::kObjectType);
+				imageValue.AddMember("uri", rapidjson::Value(Utils::String::VA("textures/%s.png", image->name), allocator), allocator);
+				images.PushBack(imageValue, allocator);
+
+				rapidjson::Value texture(rapidjson::kObjectType);
+				texture.AddMember("source", images.Size() - 1, allocator);
+				textures.PushBack(texture, allocator);
+				return textures.Size() - 1;
+			};
+
+			// Positions, with the bounds glTF requires
+			float mins[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+			float maxs[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+			auto offset = bin.size();
+			for (const auto& vertex : this->vertices_)
+			{
+				bin.append(reinterpret_cast<const char*>(vertex.coordinate), sizeof(vertex.coordinate));
+				for (auto axis = 0; axis < 3; ++axis)
+				{
+					mins[axis] = std::min(mins[axis], vertex.coordinate[axis]);
+					maxs[axis] = std::max(maxs[axis], vertex.coordinate[axis]);
+				}
+			}
+
+			auto& positions = addAccessor(addView(offset, GLTF_ARRAY_BUFFER), GLTF_FLOAT, this->vertices_.size(), "VEC3");
+			rapidjson::Value minValue(rapidjson::kArrayType), maxValue(rapidjson::kArrayType);
+			for (auto axis = 0; axis < 3; ++axis)
+			{
+				minValue.PushBack(this->vertices_.empty() ? 0.0f : mins[axis], allocator);
+				maxValue.PushBack(this->vertices_.empty() ? 0.0f : maxs[axis], allocator);
+			}
+			positions.AddMember("min", minValue, allocator);
+			positions.AddMember("max", maxValue, allocator);
+
+			offset = bin.size();
+			for (const auto& vertex : this->vertices_)
+			{
+				bin.append(reinterpret_cast<const char*>(vertex.normal), sizeof(vertex.normal));
+			}
+			addAccessor(addView(offset, GLTF_ARRAY_BUFFER), GLTF_FLOAT, this->vertices_.size(), "VEC3");
+
+			// glTF uses the same top-left texture origin as the game, so undo the flip the OBJ output applies
+			offset = bin.size();
+			for (const auto& vertex : this->vertices_)
+			{
+				const float texture[2] = { vertex.texture[0], -vertex.texture[1] };
+				bin.append(reinterpret_cast<const char*>(texture), sizeof(texture));
+			}
+			addAccessor(addView(offset, GLTF_ARRAY_BUFFER), GLTF_FLOAT, this->vertices_.size(), "VEC2");
+
+			for (const auto& material : this->facesOrder_)
+			{
+				const auto& faces = this->getFaceList(material).indices;
+
+				auto* colorMap = this->extractImage(material, "colorMap");
+				auto* normalMap = this->extractImage(material, "normalMap");
+				this->extractImage(material, "specularMap");
+
+				if (faces.empty()) continue;
+
+				rapidjson::Value materialValue(rapidjson::kObjectType);
+				materialValue.AddMember("name", rapidjson::Value(this->getMaterialName(material).data(), allocator), allocator);
+
+				rapidjson::Value pbr(rapidjson::kObjectType);
+				pbr.AddMember("metallicFactor", 0.0f, allocator);
+				if (colorMap)
+				{
+					rapidjson::Value baseColor(rapidjson::kObjectType);
+					baseColor.AddMember("index", addImage(colorMap), allocator);
+					pbr.AddMember("baseColorTexture", baseColor, allocator);
+				}
+				materialValue.AddMember("pbrMetallicRoughness", pbr, allocator);
+
+				if (normalMap)
+				{
+					rapidjson::Value normal(rapidjson::kObjectType);
+					normal.AddMember("index", addImage(normalMap), allocator);
+					materialValue.AddMember("normalTexture", normal, allocator);
+				}
+
+				materials.PushBack(materialValue, allocator);
+
+				// Face indices are 1-based for OBJ
+				offset = bin.size();
+				for (const auto& face : faces)
+				{
+					const std::uint32_t indices[3] = { static_cast<std::uint32_t>(face.a - 1), static_cast<std::uint32_t>(face.b - 1), static_cast<std::uint32_t>(face.c - 1) };
+					bin.append(reinterpret_cast<const char*>(indices), sizeof(indices));
+				}
+				addAccessor(addView(offset, GLTF_ELEMENT_ARRAY_BUFFER), GLTF_UNSIGNED_INT, faces.size() * 3, "SCALAR");
+
+				rapidjson::Value attributes(rapidjson::kObjectType);
+				attributes.AddMember("POSITION", 0, allocator);
+				attributes.AddMember("NORMAL", 1, allocator);
+				attributes.AddMember("TEXCOORD_0", 2, allocator);
+
+				rapidjson::Value primitive(rapidjson::kObjectType);
+				primitive.AddMember("attributes", attributes, allocator);
+				primitive.AddMember("indices", accessors.Size() - 1, allocator);
+				primitive.AddMember("material", materials.Size() - 1, allocator);
+				primitives.PushBack(primitive, allocator);
+			}
+
+			rapidjson::Value asset(rapidjson::kObjectType);
+			asset.AddMember("version", "2.0", allocator);
+			asset.AddMember("generator", "IW4x", allocator);
+
+			rapidjson::Value mesh(rapidjson::kObjectType);
+			mesh.AddMember("name", rapidjson::StringRef(this->world_->baseName), allocator);
+			mesh.AddMember("primitives", primitives, allocator);
+			rapidjson::Value meshes(rapidjson::kArrayType);
+			meshes.PushBack(mesh, allocator);
+
+			rapidjson::Value node(rapidjson::kObjectType);
+			node.AddMember("name", rapidjson::StringRef(this->world_->baseName), allocator);
+			node.AddMember("mesh", 0, allocator);
+			rapidjson::Value nodes(rapidjson::kArrayType);
+			nodes.PushBack(node, allocator);
+
+			rapidjson::Value sceneNodes(rapidjson::kArrayType);
+			sceneNodes.PushBack(0, allocator);
+			rapidjson::Value scene(rapidjson::kObjectType);
+			scene.AddMember("nodes", sceneNodes, allocator);
+			rapidjson::Value scenes(rapidjson::kArrayType);
+			scenes.PushBack(scene, allocator);
+
+			// The binary chunk has to be 4-byte aligned
+			bin.resize((bin.size() + 3) & ~static_cast<std::size_t>(3), '\0');
+
+			rapidjson::Value buffer(rapidjson::kObjectType);
+			buffer.AddMember("byteLength", static_cast<std::uint64_t>(bin.size()), allocator);
+			rapidjson::Value buffers(rapidjson::kArrayType);
+			buffers.PushBack(buffer, allocator);
+
+			document.AddMember("asset", asset, allocator);
+			document.AddMember("scene", 0, allocator);
+			document.AddMember("scenes", scenes, allocator);
+			document.AddMember("nodes", nodes, allocator);
+			document.AddMember("meshes", meshes, allocator);
+			document.AddMember("materials", materials, allocator);
+			if (!textures.Empty())
+			{
+				document.AddMember("textures", textures, allocator);
+				document.AddMember("images", images, allocator);
+			}
+			document.AddMember("buffers", buffers, allocator);
+			document.AddMember("bufferViews", bufferViews, allocator);
+			document.AddMember("accessors", accessors, allocator);
+
+			rapidjson::StringBuffer jsonBuffer;
+			rapidjson::Writer<rapidjson::StringBuffer> writer(jsonBuffer);
+			document.Accept(writer);
+
+			std::string json(jsonBuffer.GetString(), jsonBuffer.GetSize());
+			json.resize((json.size() + 3) & ~static_cast<std::size_t>(3), ' ');
+
+			const auto appendWord = [](std::string& out, const std::uint32_t value)
+			{
+				out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+			};
+
+			std::string header;
+			appendWord(header, 0x46546C67); // 'glTF'
+			appendWord(header, 2);
+			appendWord(header, static_cast<std::uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+			appendWord(header, static_cast<std::uint32_t>(json.size()));
+			appendWord(header, 0x4E4F534A); // 'JSON'
+
+			std::string binHeader;
+			appendWord(binHeader, static_cast<std::uint32_t>(bin.size()));
+			appendWord(binHeader, 0x004E4942); // 'BIN'
+
+			Logger::Print("Writing files...\n");
+
+			File file(Utils::String::VA("raw/mapdump/%s/%s.glb", this->world_->baseName, this->world_->baseName), true);
+			file.append(header);
+			file.append(json);
+			file.append(binHeader);
+			file.append(bin);
+		}
 	};
 
 	MapDump::MapDump()
 	{
-		Command::Add("dumpmap", []()
+		Command::Add("dumpmap", [](const Command::Params* params)
 		{
 			if (Dedicated::IsEnabled() || ZoneBuilder::IsEnabled())
 			{
@@ -449,8 +770,10 @@ namespace Components
 
 			if (world)
 			{
+				const auto binary = params->size() > 1 && Utils::String::ToLower(params->get(1)) == "glb";
+
 				MapDumper dumper(world);
-				dumper.dump();
+				dumper.dump(binary);
 
 				Logger::Print("Map '{}' exported!\n", world->baseName);
 			}
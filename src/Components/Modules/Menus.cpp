@@ -1,6 +1,7 @@
 #include "Menus.hpp"
 #include "Party.hpp"
 #include "Events.hpp"
+#include "FastFiles.hpp"
 // Ensure you have includes for AssetHandler, if it's a separate component.
 // #include "AssetHandler.hpp" // If AssetHandler is in its own header
 
@@ -42,6 +43,10 @@ namespace Components
 
 	Utils::Memory::Allocator Menus::Allocator;
 
+	std::string Menus::LoadedSourceFingerprint;
+	unsigned int Menus::LoadedZoneGeneration = 0;
+	std::vector<HANDLE> Menus::MenuSourceWatches;
+
 	Game::KeywordHashEntry<Game::menuDef_t, 128, 3523>** menuParseKeywordHash;
 
 	template <int HASH_COUNT, int HASH_SEED>
@@ -655,6 +660,13 @@ namespace Components
 		}
 	}
 
+	bool Menus::IsMenuAssetLoaded(const std::string& name, const Game::menuDef_t* menu)
+	{
+		// The tracked original may belong to a zone that has been unloaded since
+		const auto* entry = Game::DB_FindXAssetEntry(Game::ASSET_TYPE_MENU, name.data());
+		return entry && entry->asset.header.menu == menu;
+	}
+
 	void Menus::PrepareToUnloadMenu(Game::menuDef_t* menu)
 	{
 		const std::string name = menu->window.name;
@@ -664,6 +676,12 @@ namespace Components
 		if (OverridenMenus.count(name)) {
 			originalMenu = OverridenMenus[name]; // This could be nullptr if it was an implicit override of an unknown pointer
 			DebugPrint("PrepareToUnloadMenu: Unloading menu '{}' ({:X}). Original was tracked as {:X}.", name, (unsigned int)menu, (unsigned int)originalMenu);
+
+			if (originalMenu && !IsMenuAssetLoaded(name, originalMenu))
+			{
+				DebugPrint("PrepareToUnloadMenu: Original menu '{}' ({:X}) is no longer loaded, not restoring it.", name, (unsigned int)originalMenu);
+				originalMenu = nullptr;
+			}
 		}
 		else {
 			// This case might happen if a menu was loaded and became an implicit override,
@@ -1351,6 +1369,9 @@ namespace Components
 			std::memset(Game::cgDC->menuStack, 0, sizeof(Game::cgDC->menuStack));
 		}
 
+		// Supporting data was reset, so nothing parsed before can be reused
+		LoadedSourceFingerprint.clear();
+
 		// Initialize Menus::SupportingData structure with arrays if they were freed.
 		// This should be done AFTER FreeLocalSupportingDataContents().
 		// If your `FreeLocalSupportingDataContents` only clears the data inside,
@@ -1368,9 +1389,144 @@ namespace Components
 	// This is fired up _right before the game starts_, we need to do it once again to load "ingame" menus that we might have skipped prior
 	void Menus::ReloadDiskMenus_OnCGameStart()
 	{
+		const auto connectionState = *reinterpret_cast<Game::connstate_t*>(0xB2C540);
+		const bool allowStrayMenus = connectionState > Game::connstate_t::CA_DISCONNECTED
+			&& Game::CL_IsCgameInitialized();
+
+		// Every map change lands here. If no menu source changed and no zone was freed since the last parse,
+		// keep the parsed menus and only register them with the contexts again. Parsed menus hold material,
+		// sound and font pointers that may come from any zone, so a freed zone always means parsing again.
+		if (!LoadedSourceFingerprint.empty() && LoadedZoneGeneration == FastFiles::GetUnloadGeneration()
+			&& !HaveMenuSourcesChanged() && GetMenuSourceFingerprint(GetDiskMenuSources(allowStrayMenus)) == LoadedSourceFingerprint)
+		{
+			DebugPrint("Menu sources unchanged, reusing {} parsed disk menus", MenusFromDisk.size());
+
+			// Drop the override records first, the originals they point to may have been freed with the previous map's zones
+			for (const auto& [name, menu] : MenusFromDisk)
+			{
+				PrepareToUnloadMenu(menu);
+			}
+
+			// Then register again, which captures the menus that are loaded now as the originals
+			for (const auto& [name, menu] : MenusFromDisk)
+			{
+				AfterLoadedMenuFromDisk(menu);
+			}
+
+			return;
+		}
+
 		ReloadDiskMenus();
 	}
 
+	std::vector<std::pair<std::string, bool>> Menus::GetDiskMenuSources(bool allowStrayMenus)
+	{
+		std::vector<std::pair<std::string, bool>> sources;
+
+		// Load standalone menus
+		for (const auto& filename : FileSystem::GetFileList("ui_mp", "menu", Game::FS_LIST_ALL))
+		{
+			sources.emplace_back(std::format("ui_mp\\{}", filename), allowStrayMenus);
+		}
+
+		if (allowStrayMenus)
+		{
+			for (const auto& filename : FileSystem::GetFileList("ui_mp\\scriptmenus", "menu", Game::FS_LIST_ALL))
+			{
+				sources.emplace_back(std::format("ui_mp\\scriptmenus\\{}", filename), allowStrayMenus);
+			}
+		}
+
+		// Load menu list
+		for (const auto& filename : FileSystem::GetFileList("ui_mp", "txt", Game::FS_LIST_ALL))
+		{
+			sources.emplace_back(std::format("ui_mp\\{}", filename), true);
+		}
+
+		// "code.txt" for IW4x
+		for (const auto& menuName : CustomIW4xMenus)
+		{
+			sources.emplace_back(menuName, true);
+		}
+
+		return sources;
+	}
+
+	std::string Menus::GetMenuSourceFingerprint(const std::vector<std::pair<std::string, bool>>& sources)
+	{
+		std::string state;
+
+		for (const auto& [path, allowNewMenus] : sources)
+		{
+			state.append(allowNewMenus ? "+" : "-");
+			state.append(path);
+			state.append("\n");
+		}
+
+		// Menu files are never read here, iwds are identified by their checksum. Loose files are covered by
+		// the change notifications from WatchMenuSources, only the presence of their folders is recorded.
+		for (auto* search = *Game::fs_searchpaths; search; search = search->next)
+		{
+			if (search->iwd)
+			{
+				state.append(std::format("{}:{:X}\n", search->iwd->iwdFilename, search->iwd->checksum));
+			}
+			else if (search->dir)
+			{
+				const auto root = std::filesystem::path(search->dir->path) / search->dir->gamedir;
+
+				std::error_code ec;
+				state.append(std::format("{}:{}:{}\n", root.string(), std::filesystem::is_directory(root / "ui", ec), std::filesystem::is_directory(root / "ui_mp", ec)));
+			}
+		}
+
+		return Utils::Cryptography::SHA1::Compute(state);
+	}
+
+	void Menus::WatchMenuSources()
+	{
+		for (auto* handle : MenuSourceWatches)
+		{
+			FindCloseChangeNotification(handle);
+		}
+
+		MenuSourceWatches.clear();
+
+		for (auto* search = *Game::fs_searchpaths; search; search = search->next)
+		{
+			if (!search->dir) continue;
+
+			const auto root = std::filesystem::path(search->dir->path) / search->dir->gamedir;
+
+			// Includes usually live outside of ui_mp, so ui is watched as well
+			for (const auto* folder : { "ui", "ui_mp" })
+			{
+				const auto path = root / folder;
+
+				std::error_code ec;
+				if (!std::filesystem::is_directory(path, ec)) continue;
+
+				auto* handle = FindFirstChangeNotificationA(path.string().data(), TRUE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+				if (handle == INVALID_HANDLE_VALUE)
+				{
+					// Can't tell whether this folder changes, never reuse the parsed menus
+					LoadedSourceFingerprint.clear();
+					continue;
+				}
+
+				MenuSourceWatches.push_back(handle);
+			}
+		}
+	}
+
+	bool Menus::HaveMenuSourcesChanged()
+	{
+		return std::ranges::any_of(MenuSourceWatches, [](HANDLE handle)
+		{
+			return WaitForSingleObject(handle, 0) != WAIT_TIMEOUT;
+		});
+	}
+
 	void Menus::ReloadDiskMenus()
 	{
 		const auto connectionState = *reinterpret_cast<Game::connstate_t*>(0xB2C540);
@@ -1382,6 +1538,8 @@ namespace Components
 
 		DebugPrint("Reloading disk menus...");
 
+		LoadedSourceFingerprint.clear();
+
 		// Step 1: unload everything
 		const auto listsFromDisk = MenuListsFromDisk;
 		for (const auto& menuList : listsFromDisk)
@@ -1420,47 +1578,15 @@ namespace Components
 		}
 
 		// Step 2: Load everything
+		const auto sources = GetDiskMenuSources(allowStrayMenus);
+		for (const auto& [path, allowNewMenus] : sources)
 		{
-			const auto menus = FileSystem::GetFileList("ui_mp", "menu", Game::FS_LIST_ALL);
-
-			// Load standalone menus
-			for (const auto& filename : menus)
-			{
-				const std::string fullPath = std::format("ui_mp\\{}", filename);
-
-				LoadScriptMenu(fullPath.c_str(), allowStrayMenus);
-			}
-
-			if (allowStrayMenus)
-			{
-				const auto scriptmenus = FileSystem::GetFileList("ui_mp\\scriptmenus", "menu", Game::FS_LIST_ALL);
-
-				// Load standalone menus
-				for (const auto& filename : scriptmenus)
-				{
-					const std::string fullPath = std::format("ui_mp\\scriptmenus\\{}", filename);
-
-					LoadScriptMenu(fullPath.c_str(), allowStrayMenus);
-				}
-			}
+			LoadScriptMenu(path.data(), allowNewMenus);
 		}
 
-		{
-			const auto menuLists = FileSystem::GetFileList("ui_mp", "txt", Game::FS_LIST_ALL);
-
-			// Load menu list
-			for (const auto& filename : menuLists)
-			{
-				const std::string fullPath = std::format("ui_mp\\{}", filename);
-				LoadScriptMenu(fullPath.c_str(), true);
-			}
-
-			// "code.txt" for IW4x
-			for (const auto& menuName : CustomIW4xMenus)
-			{
-				LoadScriptMenu(menuName.c_str(), true);
-			}
-		}
+		LoadedSourceFingerprint = GetMenuSourceFingerprint(sources);
+		LoadedZoneGeneration = FastFiles::GetUnloadGeneration();
+		WatchMenuSources();
 
 		// Step 3 - Keep supporting data around
 
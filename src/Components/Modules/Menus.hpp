@@ -39,6 +39,11 @@ namespace Components
 
 		static Utils::Memory::Allocator Allocator;
 
+		// Fingerprint of the menu sources the currently loaded disk menus were parsed from
+		static std::string LoadedSourceFingerprint;
+		static unsigned int LoadedZoneGeneration;
+		static std::vector<HANDLE> MenuSourceWatches;
+
 		static bool MenuAlreadyExists(const std::string& name);
 
 		static void FreeZAllocatedMemory(const void* ptr, bool fromTheGame = false);
@@ -54,6 +59,7 @@ namespace Components
 		}
 
 		static void PrepareToUnloadMenu(Game::menuDef_t* menu);
+		static bool IsMenuAssetLoaded(const std::string& name, const Game::menuDef_t* menu);
 		static void AfterLoadedMenuFromDisk(Game::menuDef_t* menu);
 
 		static Game::Statement_s* ReallocateExpressionLocally(Game::Statement_s* statement, bool andFree = false);
@@ -77,6 +83,11 @@ namespace Components
 
 		static void ReloadDiskMenus();
 
+		static std::vector<std::pair<std::string, bool>> GetDiskMenuSources(bool allowStrayMenus);
+		static std::string GetMenuSourceFingerprint(const std::vector<std::pair<std::string, bool>>& sources);
+		static void WatchMenuSources();
+		static bool HaveMenuSourcesChanged();
+
 		static void LoadScriptMenu(const char* menu, bool allowNewMenus);
 
 		static Game::script_s* LoadMenuScript(const std::string& name, const std::string& buffer);
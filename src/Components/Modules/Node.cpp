@@ -406,7 +406,7 @@ namespace Components
 		Scheduler::Loop([]
 			{
 				StoreNodes(false);
-			}, Scheduler::Pipeline::ASYNC, 5min);
+			}, Scheduler::Pipeline::ASYNC_IO, 5min);
 
 		Scheduler::Loop(RunFrame, Scheduler::Pipeline::MAIN);
 
@@ -6,6 +6,8 @@
 #include "Gamepad.hpp"
 #include "ModList.hpp"
 #include "Node.hpp"
+#include "Playlist.hpp"
+#include "ServerInfo.hpp"
 #include "ServerList.hpp"
 #include "Stats.hpp"
 #include "TextRenderer.hpp"
@@ -58,6 +60,18 @@ namespace Components
 	static std::array<int, 4> s_assigned_character_ids = { -1, -1, -1, -1 };
 	const int MAX_PARTY_SLOTS = 4;
 
+	// Dvars mirrored to party members, resolved once on first broadcast
+	struct BroadcastDvar
+	{
+		const char* name;
+		bool isString;
+		Dvar::Var var;
+	};
+
+	static std::vector<BroadcastDvar> s_broadcastDvars;
+	static std::vector<std::string> s_lastBroadcastValues;
+	static std::set<std::uint64_t> s_lastBroadcastMembers;
+
 	uint64_t Party::GetLocalPlayerXUID() {
 		return Steam::SteamUser()->GetSteamID().bits;
 	}
@@ -223,7 +237,7 @@ namespace Components
 		return PartyEnable.get<bool>();
 	}
 
-	void Party::BroadcastDvarUpdate()
+	void Party::BroadcastDvarUpdate(const bool force)
 	{
 		if (!Dvar::Var("party_host").get<bool>())
 		{
@@ -241,42 +255,74 @@ namespace Components
 			return;
 		}
 
-		Utils::InfoString info;
-		int zombieModeVal = Dvar::Var("zombiemode").get<int>();
-		int hitmarkersVal = Dvar::Var("ui_hitmarker").get<int>();
-		int showDamageVal = Dvar::Var("ui_showdamage").get<int>();
-		int zombieCounterVal = Dvar::Var("ui_zombiecounter").get<int>();
-		int perkLocationsVal = Dvar::Var("ui_perklocations").get<int>();
-		int thirdPersonVal = Dvar::Var("thirdPerson").get<int>();
-		int addBotsVal = Dvar::Var("addBots").get<int>();
-		int partyPrivacyVal = Dvar::Var("partyPrivacy").get<int>();
-		std::string character1Val = Dvar::Var("character_1").get<std::string>();
-		std::string character2Val = Dvar::Var("character_2").get<std::string>();
-		std::string character3Val = Dvar::Var("character_3").get<std::string>();
-		std::string character4Val = Dvar::Var("character_4").get<std::string>();
-
-		info.set("zombiemode", std::to_string(zombieModeVal));
-		info.set("ui_hitmarker", std::to_string(hitmarkersVal));
-		info.set("ui_showdamage", std::to_string(showDamageVal));
-		info.set("ui_zombiecounter", std::to_string(zombieCounterVal));
-		info.set("ui_perklocations", std::to_string(perkLocationsVal));
-		info.set("thirdPerson", std::to_string(thirdPersonVal));
-		info.set("addBots", std::to_string(addBotsVal));
-		info.set("partyPrivacy", std::to_string(partyPrivacyVal));
-		info.set("character_1", character1Val);
-		info.set("character_2", character2Val);
-		info.set("character_3", character3Val);
-		info.set("character_4", character4Val);
-
-		int totalPlayers = Dvar::Var("party_currentPlayers").get<int>();
-		int realPlayers = Dvar::Var("party_realPlayers").get<int>();
-		info.set("party_currentPlayers", std::to_string(totalPlayers));
-		info.set("party_realPlayers", std::to_string(realPlayers));
+		if (s_broadcastDvars.empty())
+		{
+			static const std::pair<const char*, bool> names[] =
+			{
+				{ "zombiemode", false }, { "ui_hitmarker", false }, { "ui_showdamage", false },
+				{ "ui_zombiecounter", false }, { "ui_perklocations", false }, { "thirdPerson", false },
+				{ "addBots", false }, { "partyPrivacy", false },
+				{ "character_1", true }, { "character_2", true }, { "character_3", true }, { "character_4", true },
+				{ "party_currentPlayers", false }, { "party_realPlayers", false },
+				{ "character_1_player", true }, { "character_2_player", true }, { "character_3_player", true }, { "character_4_player", true },
+			};
+
+			for (const auto& [name, isString] : names)
+			{
+				s_broadcastDvars.push_back({ name, isString, Dvar::Var(name) });
+			}
+		}
+
+		// Compare against the last payload and only rebuild when a value actually changed
+		bool valuesChanged = force || s_lastBroadcastValues.size() != s_broadcastDvars.size();
+		s_lastBroadcastValues.resize(s_broadcastDvars.size());
+
+		for (std::size_t i = 0; i < s_broadcastDvars.size(); ++i)
+		{
+			auto& dvar = s_broadcastDvars[i];
+			auto& last = s_lastBroadcastValues[i];
 
-		info.set("character_1_player", Dvar::Var("character_1_player").get<std::string>());
-		info.set("character_2_player", Dvar::Var("character_2_player").get<std::string>());
-		info.set("character_3_player", Dvar::Var("character_3_player").get<std::string>());
-		info.set("character_4_player", Dvar::Var("character_4_player").get<std::string>());
+			if (dvar.isString)
+			{
+				const char* value = dvar.var.get<const char*>();
+				if (last != value)
+				{
+					last = value;
+					valuesChanged = true;
+				}
+			}
+			else
+			{
+				const int value = dvar.var.get<int>();
+				if (last.empty() || std::strtol(last.data(), nullptr, 10) != value)
+				{
+					last = std::to_string(value);
+					valuesChanged = true;
+				}
+			}
+		}
+
+		std::set<std::uint64_t> members;
+		for (int i = 0; i < maxPartyMembers && i < MAX_PARTY_SLOTS; ++i)
+		{
+			const auto& member = Game::g_lobbyData->partyMembers[i];
+			if (member.status != 0 && member.player != GetLocalPlayerXUID() && Party::g_xuidToPublicAddressMap.contains(member.player))
+			{
+				members.insert(member.player);
+			}
+		}
+
+		// Unchanged state only needs to reach members that joined since the last send
+		if (!valuesChanged && members == s_lastBroadcastMembers)
+		{
+			return;
+		}
+
+		Utils::InfoString info;
+		for (std::size_t i = 0; i < s_broadcastDvars.size(); ++i)
+		{
+			info.set(s_broadcastDvars[i].name, s_lastBroadcastValues[i]);
+		}
 
 		const std::string builtDvarString = info.build();
 		int totalSent = 0;
@@ -301,6 +347,11 @@ namespace Components
 				continue;
 			}
 
+			if (!valuesChanged && s_lastBroadcastMembers.contains(memberXuid))
+			{
+				continue;
+			}
+
 			Components::Network::Address targetAddr;
 
 			auto it = Party::g_xuidToPublicAddressMap.find(memberXuid);
@@ -321,6 +372,8 @@ namespace Components
 			Network::SendCommand(targetAddr, "dvarUpdate", builtDvarString);
 			++totalSent;
 		}
+
+		s_lastBroadcastMembers = std::move(members);
 	}
 
 	const char* GetCharacterNameFromId(int id)
@@ -798,6 +851,11 @@ namespace Components
 		// Basic info handler
 		Network::OnClientPacket("getInfo", [](const Network::Address& address, [[maybe_unused]] const std::string& data)
 			{
+				if (!ServerInfo::IsQueryAllowed(address))
+				{
+					return;
+				}
+
 				Utils::InfoString clientInfo(data);
 
 				std::string receivedChallenge;
@@ -868,6 +926,10 @@ namespace Components
 				hostResponseInfo.set("protocol", std::to_string(PROTOCOL));
 				hostResponseInfo.set("version", REVISION_STR);
 				hostResponseInfo.set("checksum", std::to_string(Game::Sys_Milliseconds()));
+				if (Playlist::GetPlaylistHash())
+				{
+					hostResponseInfo.set("playlistHash", std::to_string(Playlist::GetPlaylistHash()));
+				}
 				hostResponseInfo.set("mapname", Dvar::Var("mapname").get<std::string>());
 				if (Container.matchType == JoinContainer::MatchType::DEDICATED_MATCH)
 				{
@@ -1132,7 +1194,7 @@ namespace Components
 								// Send playlist request
 								Container.requestTime = Game::Sys_Milliseconds();
 								Container.awaitingPlaylist = true;
-								Network::SendCommand(Container.target, "getplaylist", Dvar::Var("password").get<std::string>());
+								Network::SendCommand(Container.target, "getplaylist", Playlist::BuildPlaylistRequest(Dvar::Var("password").get<std::string>(), Container.info.get("playlistHash")));
 
 								// This is not a safe method
 								// TODO: Fix actual error!
@@ -1233,22 +1295,23 @@ namespace Components
 					static int s_lastRealPlayers = 0;
 					static int s_lastBotsToAdd = 0;
 
-					int currentDvarValues[8] = {
-						Dvar::Var("zombiemode").get<int>(),
-						Dvar::Var("ui_hitmarker").get<int>(),
-						Dvar::Var("ui_showdamage").get<int>(),
-						Dvar::Var("ui_zombiecounter").get<int>(),
-						Dvar::Var("ui_perklocations").get<int>(),
-						Dvar::Var("thirdPerson").get<int>(),
-						Dvar::Var("addBots").get<int>(),
-						Dvar::Var("partyPrivacy").get<int>()
+					static Dvar::Var watchedDvars[8] = {
+						Dvar::Var("zombiemode"),
+						Dvar::Var("ui_hitmarker"),
+						Dvar::Var("ui_showdamage"),
+						Dvar::Var("ui_zombiecounter"),
+						Dvar::Var("ui_perklocations"),
+						Dvar::Var("thirdPerson"),
+						Dvar::Var("addBots"),
+						Dvar::Var("partyPrivacy")
 					};
 
 					for (int i = 0; i < 8; i++)
 					{
-						if (currentDvarValues[i] != s_lastDvarValues[i])
+						const int currentValue = watchedDvars[i].get<int>();
+						if (currentValue != s_lastDvarValues[i])
 						{
-							s_lastDvarValues[i] = currentDvarValues[i];
+							s_lastDvarValues[i] = currentValue;
 							needsBroadcast = true;
 						}
 					}
@@ -1341,6 +1404,12 @@ namespace Components
 						needsUpdatePartystate = false;
 					}
 				}, Scheduler::Pipeline::MAIN, 5ms);
+
+			// Updates are unacknowledged OOB packets, send the full state to everyone every now and then in case one got lost
+			Scheduler::Loop([]
+			{
+				BroadcastDvarUpdate(true);
+			}, Scheduler::Pipeline::MAIN, 5s);
 		}
 	}
 }
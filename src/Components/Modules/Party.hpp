@@ -28,7 +28,7 @@ namespace Components
 		static int GetMaxClients();
 
 		// ZW3 - Real-time dvar broadcasting
-		static void BroadcastDvarUpdate();
+		static void BroadcastDvarUpdate(bool force = false);
 		static std::map<uint64_t, Network::Address> g_xuidToPublicAddressMap;
 
 		static uint64_t GetLocalPlayerXUID();
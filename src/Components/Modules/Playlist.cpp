@@ -8,7 +8,11 @@
 namespace Components
 {
 	std::string Playlist::CurrentPlaylistBuffer;
+	std::uint32_t Playlist::CurrentPlaylistHash;
+	std::string Playlist::CurrentPlaylistResponse;
+	std::string Playlist::CurrentPlaylistUnchangedResponse;
 	std::string Playlist::ReceivedPlaylistBuffer;
+	std::uint32_t Playlist::ReceivedPlaylistHash;
 	std::unordered_map<const void*, std::string> Playlist::MapRelocation;
 
 	void Playlist::LoadPlaylist()
@@ -41,35 +45,69 @@ namespace Components
 		}
 	}
 
+	std::uint32_t Playlist::GetPlaylistHash()
+	{
+		return CurrentPlaylistHash;
+	}
+
+	std::string Playlist::BuildPlaylistRequest(const std::string& password, const std::string& hostHash)
+	{
+		// Only ask for an 'unchanged' reply if the host advertised the playlist we already hold
+		if (hostHash.empty() || ReceivedPlaylistBuffer.empty() || hostHash != std::to_string(ReceivedPlaylistHash))
+		{
+			return password;
+		}
+
+		return password + "\n" + hostHash;
+	}
+
 	char* Playlist::Com_ParseOnLine_Hk(const char** data_p)
 	{
 		MapRelocation.clear();
 		CurrentPlaylistBuffer = Utils::Compression::ZLib::Compress(*data_p);
+		CurrentPlaylistHash = Utils::Cryptography::JenkinsOneAtATime::Compute(CurrentPlaylistBuffer);
+
+		// Responses are built once here instead of on every request
+		Proto::Party::Playlist list;
+		list.set_hash(CurrentPlaylistHash);
+		CurrentPlaylistUnchangedResponse = list.SerializeAsString();
+		list.set_buffer(CurrentPlaylistBuffer);
+		CurrentPlaylistResponse = list.SerializeAsString();
+
 		return Game::Com_ParseOnLine(data_p);
 	}
 
 	void Playlist::PlaylistRequest(const Network::Address& address, [[maybe_unused]] const std::string& data)
 	{
+		// Newer clients append the hash of the playlist they hold
+		std::string_view requestPassword = data;
+		std::string_view heldHash;
+		if (const auto separator = requestPassword.find('\n'); separator != std::string_view::npos)
+		{
+			heldHash = requestPassword.substr(separator + 1);
+			requestPassword = requestPassword.substr(0, separator);
+		}
+
 		const auto* password = *Game::g_password ? (*Game::g_password)->current.string : "";
 
 		if (*password)
 		{
-			if (password != data)
+			if (password != requestPassword)
 			{
 				Network::SendCommand(address, "playlistInvalidPassword");
 				return;
 			}
 		}
 
-		Logger::Print("Received playlist request, sending currently stored buffer.\n");
-
-		std::string compressedList = CurrentPlaylistBuffer;
-
-		Proto::Party::Playlist list;
-		list.set_hash(Utils::Cryptography::JenkinsOneAtATime::Compute(compressedList));
-		list.set_buffer(compressedList);
+		if (!heldHash.empty() && heldHash == std::to_string(CurrentPlaylistHash))
+		{
+			Logger::Print("Received playlist request, client already has the current playlist.\n");
+			Network::SendCommand(address, "playlistResponse", CurrentPlaylistUnchangedResponse);
+			return;
+		}
 
-		Network::SendCommand(address, "playlistResponse", list.SerializeAsString());
+		Logger::Print("Received playlist request, sending currently stored buffer.\n");
+		Network::SendCommand(address, "playlistResponse", CurrentPlaylistResponse);
 	}
 
 	void Playlist::PlaylistResponse(const Network::Address& address, [[maybe_unused]] const std::string& data)
@@ -93,6 +131,13 @@ namespace Components
 			Party::PlaylistError(std::format("Received playlist response from {}, but it is invalid.", address.getString()));
 			ReceivedPlaylistBuffer.clear();
 		}
+		else if (list.buffer().empty() && !ReceivedPlaylistBuffer.empty() && list.hash() == ReceivedPlaylistHash)
+		{
+			// Host confirmed we already hold its playlist
+			Logger::Print("Playlist unchanged, loading cached copy and continuing connection...\n");
+			Game::Playlist_ParsePlaylists(ReceivedPlaylistBuffer.data());
+			Party::PlaylistContinue();
+		}
 		else
 		{
 			// Generate buffer and hash
@@ -109,6 +154,7 @@ namespace Components
 
 			// Decompress buffer
 			ReceivedPlaylistBuffer = Utils::Compression::ZLib::Decompress(compressedData);
+			ReceivedPlaylistHash = hash;
 
 			// Load and continue connection
 			Logger::Print("Received playlist, loading and continuing connection...\n");
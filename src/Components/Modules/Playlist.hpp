@@ -11,10 +11,17 @@ namespace Components
 
 		static void LoadPlaylist();
 
+		static std::uint32_t GetPlaylistHash();
+		static std::string BuildPlaylistRequest(const std::string& password, const std::string& hostHash);
+
 		static std::string ReceivedPlaylistBuffer;
 
 	private:
 		static std::string CurrentPlaylistBuffer;
+		static std::uint32_t CurrentPlaylistHash;
+		static std::string CurrentPlaylistResponse;
+		static std::string CurrentPlaylistUnchangedResponse;
+		static std::uint32_t ReceivedPlaylistHash;
 		static std::unordered_map<const void*, std::string> MapRelocation;
 
 		static char* Com_ParseOnLine_Hk(const char** data_p);
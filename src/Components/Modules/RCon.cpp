@@ -6,7 +6,7 @@
 
 namespace Components
 {
-	std::unordered_map<std::uint32_t, int> RCon::RateLimit;
+	Utils::RateLimiter RCon::RateLimit(4096, 1, 500);
 
 	std::vector<std::size_t> RCon::RConAddresses;
 
@@ -92,6 +92,11 @@ namespace Components
 			Network::SendCommand(target, "rconSafe", directive.SerializeAsString());
 		});
 
+		Command::Add("rconRateLimitStats", []
+		{
+			Logger::Print("rcon: {} allowed, {} dropped ({} evictions)\n", RateLimit.getAllowed(), RateLimit.getDropped(), RateLimit.getEvicted());
+		});
+
 		Command::AddSV("RconWhitelistAdd", [](const Command::Params* params)
 		{
 			if (params->size() < 2)
@@ -122,32 +127,7 @@ namespace Components
 
 	bool RCon::RateLimitCheck(const Network::Address& address, const int time)
 	{
-		const auto ip = address.getIP();
-		const auto lastTime = RateLimit[ip.full];
-
-		if (lastTime && (time - lastTime) < RConTimeout.get<int>())
-		{
-			return false; // Flooding
-		}
-
-		RateLimit[ip.full] = time;
-		return true;
-	}
-
-	void RCon::RateLimitCleanup(const int time)
-	{
-		for (auto i = RateLimit.begin(); i != RateLimit.end();)
-		{
-			// No longer at risk of flooding, remove
-			if ((time - i->second) > RConTimeout.get<int>())
-			{
-				i = RateLimit.erase(i);
-			}
-			else
-			{
-				++i;
-			}
-		}
+		return RateLimit.allow(address.getIP().full, time);
 	}
 
 	void RCon::RConExecutor(const Network::Address& address, std::string data)
@@ -246,8 +226,22 @@ namespace Components
 			RConPassword =  Dvar::Register<const char*>("rcon_password", "", Game::DVAR_NONE, "The password for rcon");
 			RConLogRequests = Dvar::Register<bool>("rcon_log_requests", false, Game::DVAR_NONE, "Print remote commands in log");
 			RConTimeout = Dvar::Register<int>("rcon_timeout", 500, 100, 10000, Game::DVAR_NONE, "");
+
+			RateLimit.setLimits(1, RConTimeout.get<int>());
 		});
 
+		// One request per rcon_timeout, only touch the limiter when the dvar changes
+		Scheduler::Loop([]
+		{
+			static auto lastTimeout = 0;
+
+			const auto timeout = RConTimeout.get<int>();
+			if (timeout == lastTimeout) return;
+
+			RateLimit.setLimits(1, timeout);
+			lastTimeout = timeout;
+		}, Scheduler::Pipeline::MAIN, 1s);
+
 		Network::OnClientPacket("rcon", [](const Network::Address& address, [[maybe_unused]] const std::string& data)
 		{
 			const auto hash = std::hash<std::uint32_t>()(*reinterpret_cast<const std::uint32_t*>(address.getIP().bytes));
@@ -263,8 +257,6 @@ namespace Components
 				return;
 			}
 
-			RateLimitCleanup(time);
-
 			auto rconData = data;
 			Scheduler::Once([address, s = std::move(rconData)]
 			{
@@ -287,8 +279,6 @@ namespace Components
 				return;
 			}
 
-			RateLimitCleanup(time);
-
 			if (!CryptoKeyRSA::HasPublicKey())
 			{
 				return;
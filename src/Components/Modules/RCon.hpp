@@ -37,7 +37,7 @@ namespace Components
 			static Utils::Cryptography::RSA::Key GetPrivateKeyInternal();
 		};
 
-		static std::unordered_map<std::uint32_t, int> RateLimit;
+		static Utils::RateLimiter RateLimit;
 
 		static std::vector<std::size_t> RConAddresses;
 
@@ -53,7 +53,6 @@ namespace Components
 
 		static bool IsRateLimitCheckDisabled();
 		static bool RateLimitCheck(const Network::Address& address, int time);
-		static void RateLimitCleanup(int time);
 
 		static void RConExecutor(const Network::Address& address, std::string data);
 		static void RConSafeExecutor(const Network::Address& address, std::string command);
@@ -21,6 +21,8 @@ namespace Components
 	Dvar::Var Renderer::r_drawLights;
 	Dvar::Var Renderer::r_drawClipmap;
 
+	Renderer::DebugDrawGrid Renderer::DebugGrid;
+
 	float pink[4] = { 1.0f, 0.5f, 0.0f, 1.0f };
 	float cyan[4] = { 0.0f, 0.5f, 0.5f, 1.0f };
 	float red[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
@@ -194,6 +196,8 @@ namespace Components
 	{
 		if (!r_drawTriggers.get<bool>()) return;
 
+		const auto* view = &Game::CL_GetLocalClientGlobals(0)->refdef.view;
+
 		for (std::size_t i = 0; i < Game::MAX_GENTITIES; ++i)
 		{
 			auto* ent = &Game::g_entities[i];
@@ -205,6 +209,13 @@ namespace Components
 				b.midPoint[1] += ent->r.currentOrigin[1];
 				b.midPoint[2] += ent->r.currentOrigin[2];
 
+				// Only skip what is off screen, triggers are drawn at any distance
+				const auto radius = std::sqrt(Utils::Maths::DotProduct(b.halfSize, b.halfSize));
+				if (!IsSphereInView(view, b.midPoint, radius))
+				{
+					continue;
+				}
+
 				switch (ent->handler)
 				{
 				case Game::ENT_HANDLER_TRIGGER_HURT:
@@ -485,29 +496,190 @@ namespace Components
 		}
 	}
 
-	void Renderer::DebugDrawAABBTrees()
+	const Game::clipMap_t* Renderer::GetDebugDrawGrid()
 	{
-		if (!r_drawAABBTrees.get<bool>()) return;
+		const auto* clipMap = *reinterpret_cast<Game::clipMap_t**>(0x7998E0);
+		if (!clipMap)
+		{
+			DebugGrid = {};
+			return nullptr;
+		}
 
-		Game::clipMap_t* clipMap = *reinterpret_cast<Game::clipMap_t**>(0x7998E0);
-		if (!clipMap) return;
+		// Built lazily, once per loaded clip map
+		if (DebugGrid.clipMap != clipMap || DebugGrid.checksum != clipMap->checksum)
+		{
+			BuildDebugDrawGrid(clipMap);
+		}
 
-		for (unsigned short i = 0; i < clipMap->smodelNodeCount; ++i)
+		return clipMap;
+	}
+
+	void Renderer::BuildDebugDrawGrid(const Game::clipMap_t* clipMap)
+	{
+		constexpr auto maxCellsPerAxis = 64;
+		constexpr auto minCellSize = 512.0f;
+
+		DebugGrid = {};
+		DebugGrid.clipMap = clipMap;
+		DebugGrid.checksum = clipMap->checksum;
+
+		float mins[2] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		float maxs[2] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+		const auto extend = [&](const float* point)
 		{
-			Game::R_AddDebugBounds(cyan, &clipMap->smodelNodes[i].bounds);
+			for (auto axis = 0; axis < 2; ++axis)
+			{
+				mins[axis] = std::min(mins[axis], point[axis]);
+				maxs[axis] = std::max(maxs[axis], point[axis]);
+			}
+		};
+
+		for (unsigned int i = 0; i < clipMap->numBrushes; ++i) extend(clipMap->brushBounds[i].midPoint);
+		for (unsigned int i = 0; i < clipMap->smodelNodeCount; ++i) extend(clipMap->smodelNodes[i].bounds.midPoint);
+		for (unsigned int i = 0; i < clipMap->numStaticModels; ++i) extend(clipMap->staticModelList[i].absBounds.midPoint);
+		for (unsigned int i = 0; i < clipMap->vertCount; ++i) extend(clipMap->verts[i]);
+
+		if (mins[0] > maxs[0])
+		{
+			return;
+		}
+
+		auto& grid = DebugGrid.grid;
+		grid.reset(mins, maxs, minCellSize, maxCellsPerAxis);
+
+		const auto growBounds = [](DebugDrawCell& cell, const Game::Bounds* bounds)
+		{
+			float boundsMins[3], boundsMaxs[3];
+			for (auto axis = 0; axis < 3; ++axis)
+			{
+				boundsMins[axis] = bounds->midPoint[axis] - bounds->halfSize[axis];
+				boundsMaxs[axis] = bounds->midPoint[axis] + bounds->halfSize[axis];
+			}
+
+			Utils::SpatialGrid<DebugDrawItems>::Grow(cell, boundsMins);
+			Utils::SpatialGrid<DebugDrawItems>::Grow(cell, boundsMaxs);
+		};
+
+		// Items go into the cell holding their center, which is also what the distance checks use
+		for (unsigned int i = 0; i < clipMap->numBrushes; ++i)
+		{
+			auto& cell = grid.cellAt(clipMap->brushBounds[i].midPoint);
+			cell.items.brushes.push_back(i);
+			growBounds(cell, &clipMap->brushBounds[i]);
+		}
+
+		for (unsigned int i = 0; i < clipMap->smodelNodeCount; ++i)
+		{
+			auto& cell = grid.cellAt(clipMap->smodelNodes[i].bounds.midPoint);
+			cell.items.smodelNodes.push_back(i);
+			growBounds(cell, &clipMap->smodelNodes[i].bounds);
 		}
 
 		for (unsigned int i = 0; i < clipMap->numStaticModels; i += 2)
 		{
-			Game::R_AddDebugBounds(red, &clipMap->staticModelList[i].absBounds);
+			auto& cell = grid.cellAt(clipMap->staticModelList[i].absBounds.midPoint);
+			cell.items.staticModels.push_back(i);
+			growBounds(cell, &clipMap->staticModelList[i].absBounds);
+		}
+
+		for (unsigned int i = 0; i < clipMap->partitionCount; ++i)
+		{
+			const auto* partition = &clipMap->partitions[i];
+			assert(partition->firstVertSegment == 0);
+
+			const auto* indices = &clipMap->triIndices[3 * partition->firstTri];
+			for (unsigned int j = 0; j < partition->triCount; ++j)
+			{
+				const float* points[3] = { clipMap->verts[indices[j * 3]], clipMap->verts[indices[j * 3 + 1]], clipMap->verts[indices[j * 3 + 2]] };
+
+				float centroid[3];
+				for (auto axis = 0; axis < 3; ++axis)
+				{
+					centroid[axis] = (points[0][axis] + points[1][axis] + points[2][axis]) / 3.0f;
+				}
+
+				auto& cell = grid.cellAt(centroid);
+				for (const auto* point : points)
+				{
+					cell.items.triangles.insert(cell.items.triangles.end(), point, point + 3);
+					Utils::SpatialGrid<DebugDrawItems>::Grow(cell, point);
+				}
+			}
 		}
 	}
 
+	bool Renderer::IsSphereInView(const Game::RefdefView* view, const float* center, const float radius)
+	{
+		float delta[3];
+		Utils::Maths::VectorSubtract(center, view->org, delta);
+
+		const auto forward = Utils::Maths::DotProduct(delta, view->axis[0]);
+		if (forward < -radius)
+		{
+			return false;
+		}
+
+		// Side planes of the view frustum, scaled by the plane normal length instead of normalizing
+		const auto left = Utils::Maths::DotProduct(delta, view->axis[1]);
+		if (std::abs(left) - view->tanHalfFovX * forward > radius * std::sqrt(1.0f + view->tanHalfFovX * view->tanHalfFovX))
+		{
+			return false;
+		}
+
+		const auto up = Utils::Maths::DotProduct(delta, view->axis[2]);
+		return std::abs(up) - view->tanHalfFovY * forward <= radius * std::sqrt(1.0f + view->tanHalfFovY * view->tanHalfFovY);
+	}
+
+	void Renderer::ForEachDebugDrawCell(const float* origin, const float radius, const std::function<void(DebugDrawCell& cell, bool inside)>& callback)
+	{
+		const auto* view = &Game::CL_GetLocalClientGlobals(0)->refdef.view;
+
+		DebugGrid.grid.query(origin, radius, [view](const float* center, const float cellRadius)
+		{
+			return IsSphereInView(view, center, cellRadius);
+		}, callback);
+	}
+
+	void Renderer::DebugDrawAABBTrees()
+	{
+		if (!r_drawAABBTrees.get<bool>()) return;
+
+		const auto* clipMap = GetDebugDrawGrid();
+		if (!clipMap) return;
+
+		const auto* view = &Game::CL_GetLocalClientGlobals(0)->refdef.view;
+		const auto drawDistance = static_cast<float>(r_playerDrawDebugDistance.get<int>());
+		const auto sqrDist = drawDistance * drawDistance;
+
+		ForEachDebugDrawCell(view->org, drawDistance, [&](DebugDrawCell& cell, const bool inside)
+		{
+			for (const auto index : cell.items.smodelNodes)
+			{
+				auto* bounds = &clipMap->smodelNodes[index].bounds;
+				if (inside || Utils::Maths::Vec3SqrDistance(view->org, bounds->midPoint) <= sqrDist)
+				{
+					Game::R_AddDebugBounds(cyan, bounds);
+				}
+			}
+
+			for (const auto index : cell.items.staticModels)
+			{
+				auto* bounds = &clipMap->staticModelList[index].absBounds;
+				if (inside || Utils::Maths::Vec3SqrDistance(view->org, bounds->midPoint) <= sqrDist)
+				{
+					Game::R_AddDebugBounds(red, bounds);
+				}
+			}
+		});
+	}
+
 	void Renderer::DebugDrawClipmap()
 	{
 		auto val = r_drawClipmap.get<int>();
+		if (!val) return;
 
-		Game::clipMap_t* clipMap = *reinterpret_cast<Game::clipMap_t**>(0x7998E0);
+		const auto* clipMap = GetDebugDrawGrid();
 		if (!clipMap) return;
 
 		auto clientNum = Game::CG_GetClientNum();
@@ -519,18 +691,16 @@ namespace Components
 			return;
 		}
 
-		auto drawDistance = r_playerDrawDebugDistance.get<int>();
-		unsigned int sqrDist = static_cast<unsigned int>(drawDistance * drawDistance);
+		const auto drawDistance = static_cast<float>(r_playerDrawDebugDistance.get<int>());
+		const auto sqrDist = drawDistance * drawDistance;
 		float playerPosition[3]{ clientEntity->r.currentOrigin[0], clientEntity->r.currentOrigin[1], clientEntity->r.currentOrigin[2] };
 
-		if (val)
+		ForEachDebugDrawCell(playerPosition, drawDistance, [&](DebugDrawCell& cell, const bool inside)
 		{
-			for (size_t i = 0; i < clipMap->numBrushes; i++)
+			for (const auto index : cell.items.brushes)
 			{
-				const auto bounds = &clipMap->brushBounds[i];
-				const auto dist = Utils::Maths::Vec3SqrDistance(playerPosition, bounds->midPoint);
-
-				if (dist * 3 > sqrDist)
+				const auto bounds = &clipMap->brushBounds[index];
+				if (Utils::Maths::Vec3SqrDistance(playerPosition, bounds->midPoint) * 3 > sqrDist)
 				{
 					continue;
 				}
@@ -538,52 +708,25 @@ namespace Components
 				Game::R_AddDebugBounds(green, bounds);
 			}
 
-			for (size_t i = 0; i < clipMap->partitionCount; i++)
+			// Cached triangle corners, only cells on the edge of the draw distance need per-vertex checks
+			for (std::size_t i = 0; i < cell.items.triangles.size(); i += 9)
 			{
-				const auto partition = &clipMap->partitions[i];
+				auto* A = &cell.items.triangles[i];
+				auto* B = &cell.items.triangles[i + 3];
+				auto* C = &cell.items.triangles[i + 6];
 
-				assert(partition->firstVertSegment == 0);
-
-				auto indices = &clipMap->triIndices[3 * partition->firstTri];
-				auto tris = (float(*)[3])clipMap->verts[0];
-
-				bool tooFar = false;
-				if (!tooFar)
+				if (!inside && (Utils::Maths::Vec3SqrDistance(playerPosition, A) > sqrDist
+					|| Utils::Maths::Vec3SqrDistance(playerPosition, B) > sqrDist
+					|| Utils::Maths::Vec3SqrDistance(playerPosition, C) > sqrDist))
 				{
-					for (size_t j = 0; j < partition->triCount; j++)
-					{
-						auto indiceSet = &indices[j * 3];
-
-						for (size_t triPoint = 0; triPoint < 3; triPoint++)
-						{
-							auto point = tris[indiceSet[triPoint]];
-
-							const auto dist = Utils::Maths::Vec3SqrDistance(playerPosition, point);
-
-							if (dist > sqrDist)
-							{
-								tooFar = true;
-								break;
-							}
-						}
-
-						if (tooFar)
-						{
-							continue;
-						}
-
-						auto A = tris[indiceSet[0]];
-						auto B = tris[indiceSet[1]];
-						auto C = tris[indiceSet[2]];
-
-						Game::R_AddDebugLine(pink, A, B);
-						Game::R_AddDebugLine(pink, B, C);
-						Game::R_AddDebugLine(pink, C, A);
-					}
-
+					continue;
 				}
+
+				Game::R_AddDebugLine(pink, A, B);
+				Game::R_AddDebugLine(pink, B, C);
+				Game::R_AddDebugLine(pink, C, A);
 			}
-		}
+		});
 	}
 
 	void Renderer::ForceTechnique()
@@ -21,6 +21,26 @@ namespace Components
 		static void OnDeviceRecoveryBegin(Utils::Slot<Renderer::Callback> callback);
 
 	private:
+		// Clip map geometry bucketed on a 2D grid so debug drawing only visits nearby, visible cells
+		struct DebugDrawItems
+		{
+			std::vector<unsigned int> brushes;
+			std::vector<unsigned int> smodelNodes;
+			std::vector<unsigned int> staticModels;
+			std::vector<float> triangles; // 9 floats per triangle
+		};
+
+		using DebugDrawCell = Utils::SpatialGrid<DebugDrawItems>::Cell;
+
+		struct DebugDrawGrid
+		{
+			const Game::clipMap_t* clipMap;
+			unsigned int checksum;
+			Utils::SpatialGrid<DebugDrawItems> grid;
+		};
+
+		static DebugDrawGrid DebugGrid;
+
 		static void BackendFrameStub();
 		static void BackendFrameHandler();
 
@@ -41,6 +61,10 @@ namespace Components
 		static void DebugDrawRunners();
 		static void DebugDrawAABBTrees();
 		static void DebugDrawClipmap();
+		static const Game::clipMap_t* GetDebugDrawGrid();
+		static void BuildDebugDrawGrid(const Game::clipMap_t* clipMap);
+		static bool IsSphereInView(const Game::RefdefView* view, const float* center, float radius);
+		static void ForEachDebugDrawCell(const float* origin, float radius, const std::function<void(DebugDrawCell& cell, bool inside)>& callback);
 		static void ForceTechnique();
 		static void ListSamplers();
 		static void DrawPrimaryLights();
@@ -0,0 +1,152 @@
+#include "Resolver.hpp"
+
+#include <ws2tcpip.h>
+
+namespace Components
+{
+	std::mutex Resolver::Mutex;
+	std::condition_variable Resolver::Condition;
+	std::unordered_map<std::string, Resolver::Entry> Resolver::Cache;
+	std::queue<std::string> Resolver::Queue;
+
+	bool Resolver::Terminate = false;
+	std::thread Resolver::Thread;
+
+	Dvar::Var Resolver::NetDNSCacheTime;
+
+	bool Resolver::IsNumeric(const std::string& host)
+	{
+		// Dotted IPs (with or without port) never hit DNS, NET_StringToAdr is instant for them
+		return !host.empty() && std::ranges::all_of(host, [](const unsigned char c) -> bool
+		{
+			return std::isdigit(c) || c == '.' || c == ':';
+		});
+	}
+
+	std::optional<Network::Address> Resolver::Get(const std::string& host)
+	{
+		if (IsNumeric(host))
+		{
+			Network::Address address(host);
+			if (!address.isValid()) return {};
+			return address;
+		}
+
+		std::lock_guard _(Mutex);
+
+		auto& entry = Cache[host];
+		if (entry.resolved.has_value())
+		{
+			// NET_ functions belong to the main thread, so the engine address is only built here
+			entry.address.emplace(&*entry.resolved);
+			entry.resolved.reset();
+		}
+
+		if (!entry.pending && std::chrono::steady_clock::now() >= entry.expires)
+		{
+			// Stale or unknown, revalidate in the background and hand out what we have meanwhile
+			entry.pending = true;
+			Queue.push(host);
+			Condition.notify_one();
+		}
+
+		return entry.address;
+	}
+
+	std::optional<Network::Address> Resolver::GetMasterServer()
+	{
+		const auto masterPort = (*Game::com_masterPort)->current.unsignedInt;
+		const auto* masterServerName = (*Game::com_masterServerName)->current.string;
+
+		return Get(std::format("{}:{}", masterServerName, masterPort));
+	}
+
+	std::optional<sockaddr_in> Resolver::Lookup(const std::string& host)
+	{
+		const auto separator = host.find_last_of(':');
+		const auto name = host.substr(0, separator);
+		const auto port = separator == std::string::npos ? 0 : std::strtoul(host.data() + separator + 1, nullptr, 10);
+
+		addrinfo hints{};
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_DGRAM;
+
+		addrinfo* result = nullptr;
+		if (getaddrinfo(name.data(), nullptr, &hints, &result) != 0 || !result)
+		{
+			return {};
+		}
+
+		auto address = *reinterpret_cast<sockaddr_in*>(result->ai_addr);
+		address.sin_port = htons(static_cast<std::uint16_t>(port));
+
+		freeaddrinfo(result);
+		return address;
+	}
+
+	void Resolver::Worker()
+	{
+		std::unique_lock lock(Mutex);
+
+		while (!Terminate)
+		{
+			Condition.wait(lock, []
+			{
+				return Terminate || !Queue.empty();
+			});
+
+			if (Terminate) break;
+
+			const auto host = Queue.front();
+			Queue.pop();
+
+			lock.unlock();
+			const auto address = Lookup(host);
+			lock.lock();
+
+			auto& entry = Cache[host];
+			entry.pending = false;
+
+			if (address.has_value())
+			{
+				entry.resolved = address;
+				entry.expires = std::chrono::steady_clock::now() + std::chrono::seconds(NetDNSCacheTime.get<int>());
+			}
+			else
+			{
+				// Keep serving the previous address, if any, and try again later
+				Logger::Print(Game::CON_CHANNEL_NETWORK, "Failed to resolve {}\n", host);
+				entry.expires = std::chrono::steady_clock::now() + FailureRetryTime;
+			}
+		}
+	}
+
+	Resolver::Resolver()
+	{
+		NetDNSCacheTime = Dvar::Register<int>("net_dnsCacheTime", 300, 10, 86400, Game::DVAR_NONE, "Seconds a resolved hostname is cached before it is looked up again");
+
+		Terminate = false;
+		Thread = std::thread(Worker);
+
+		// Warm up the cache so the first heartbeat or bot name request does not have to wait
+		Scheduler::OnGameInitialized([]
+		{
+			(void)GetMasterServer();
+		}, Scheduler::Pipeline::MAIN);
+	}
+
+	void Resolver::preDestroy()
+	{
+		{
+			std::lock_guard _(Mutex);
+			Terminate = true;
+		}
+
+		Condition.notify_all();
+
+		if (Thread.joinable())
+		{
+			Thread.join();
+		}
+	}
+}
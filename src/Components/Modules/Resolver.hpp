@@ -0,0 +1,43 @@
+#pragma once
+
+namespace Components
+{
+	class Resolver : public Component
+	{
+	public:
+		Resolver();
+
+		void preDestroy() override;
+
+		// Never blocks. Returns the last known address for host ("name:port", may be stale)
+		// and queues a background lookup if there is none or it expired
+		static std::optional<Network::Address> Get(const std::string& host);
+		static std::optional<Network::Address> GetMasterServer();
+
+	private:
+		class Entry
+		{
+		public:
+			std::optional<Network::Address> address;
+			std::optional<sockaddr_in> resolved; // Written by the worker, turned into address on the main thread
+			std::chrono::steady_clock::time_point expires;
+			bool pending;
+		};
+
+		static constexpr auto FailureRetryTime = 30s;
+
+		static std::mutex Mutex;
+		static std::condition_variable Condition;
+		static std::unordered_map<std::string, Entry> Cache;
+		static std::queue<std::string> Queue;
+
+		static bool Terminate;
+		static std::thread Thread;
+
+		static Dvar::Var NetDNSCacheTime;
+
+		static bool IsNumeric(const std::string& host);
+		static std::optional<sockaddr_in> Lookup(const std::string& host);
+		static void Worker();
+	};
+}
@@ -5,8 +5,10 @@ constexpr bool COND_END = true;
 namespace Components
 {
 	std::thread Scheduler::Thread;
+	std::thread Scheduler::IOThreads[SCHEDULER_IO_WORKERS];
 	volatile bool Scheduler::Kill = false;
 	Scheduler::TaskPipeline Scheduler::Pipelines[static_cast<std::underlying_type_t<Pipeline>>(Pipeline::COUNT)];
+	Scheduler::TaskPipeline Scheduler::IOPipelines[SCHEDULER_IO_WORKERS];
 
 	void Scheduler::TaskPipeline::add(Task&& task)
 	{
@@ -14,6 +16,12 @@ namespace Components
 		{
 			tasks.emplace_back(std::move(task));
 		});
+
+		const auto depth = ++this->depth_;
+		auto peak = this->peakDepth_.load();
+		while (depth > peak && !this->peakDepth_.compare_exchange_weak(peak, depth))
+		{
+		}
 	}
 
 	void Scheduler::TaskPipeline::execute()
@@ -35,10 +43,14 @@ namespace Components
 
 				i->lastCall = now;
 
+				this->busy_ = true;
 				const auto res = i->handler();
+				this->busy_ = false;
+
 				if (res == COND_END)
 				{
 					i = tasks.erase(i);
+					--this->depth_;
 				}
 				else
 				{
@@ -60,11 +72,56 @@ namespace Components
 		});
 	}
 
-	void Scheduler::Execute(Pipeline type)
+	Scheduler::TaskPipeline& Scheduler::GetPipeline(const Pipeline type)
 	{
 		assert(type < Pipeline::COUNT);
+
+		if (type == Pipeline::ASYNC_IO)
+		{
+			// Prefer an idle worker so a stalled request doesn't hold up new work
+			auto* best = &IOPipelines[0];
+			for (auto& pipeline : IOPipelines)
+			{
+				if (std::make_pair(pipeline.busy(), pipeline.depth()) < std::make_pair(best->busy(), best->depth()))
+				{
+					best = &pipeline;
+				}
+			}
+
+			return *best;
+		}
+
 		const auto index = static_cast<std::underlying_type_t<Pipeline>>(type);
-		Pipelines[index].execute();
+		return Pipelines[index];
+	}
+
+	void Scheduler::Execute(Pipeline type)
+	{
+		assert(type < Pipeline::COUNT && type != Pipeline::ASYNC_IO);
+		GetPipeline(type).execute();
+	}
+
+	void Scheduler::PrintStats()
+	{
+		static const char* names[] = { "async", "async_io", "renderer", "server", "client", "main", "quit" };
+		static_assert(std::extent_v<decltype(names)> == static_cast<std::size_t>(Pipeline::COUNT));
+
+		for (auto i = 0; i < static_cast<int>(Pipeline::COUNT); ++i)
+		{
+			if (static_cast<Pipeline>(i) == Pipeline::ASYNC_IO)
+			{
+				for (auto j = 0; j < SCHEDULER_IO_WORKERS; ++j)
+				{
+					const auto& pipeline = IOPipelines[j];
+					Logger::Print("{} #{}: {} queued, {} peak{}\n", names[i], j, pipeline.depth(), pipeline.peakDepth(), pipeline.busy() ? ", busy" : "");
+				}
+
+				continue;
+			}
+
+			const auto& pipeline = Pipelines[i];
+			Logger::Print("{}: {} queued, {} peak\n", names[i], pipeline.depth(), pipeline.peakDepth());
+		}
 	}
 
 	void Scheduler::ScrPlace_EndFrame_Hk()
@@ -107,8 +164,7 @@ namespace Components
 		task.interval = delay;
 		task.lastCall = std::chrono::high_resolution_clock::now();
 
-		const auto index = static_cast<std::underlying_type_t<Pipeline>>(type);
-		Pipelines[index].add(std::move(task));
+		GetPipeline(type).add(std::move(task));
 	}
 
 	void Scheduler::Loop(const std::function<void()>& callback, const Pipeline type,
@@ -166,6 +222,23 @@ namespace Components
 			}
 		});
 
+		for (auto i = 0; i < SCHEDULER_IO_WORKERS; ++i)
+		{
+			IOThreads[i] = Utils::Thread::CreateNamedThread(std::format("Async IO Scheduler {}", i), [i]
+			{
+				while (!Kill)
+				{
+					IOPipelines[i].execute();
+					std::this_thread::sleep_for(10ms);
+				}
+			});
+		}
+
+		Command::Add("schedulerStats", []
+		{
+			PrintStats();
+		});
+
 		Utils::Hook(0x5ACB9E, ScrPlace_EndFrame_Hk, HOOK_CALL).install()->quick();
 
 		// Hook G_Glass_Update so we may fix TLS issues
@@ -188,5 +261,13 @@ namespace Components
 		{
 			Thread.join();
 		}
+
+		for (auto& thread : IOThreads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
 	}
 }
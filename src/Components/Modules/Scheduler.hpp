@@ -1,5 +1,7 @@
 #pragma once
 
+#define SCHEDULER_IO_WORKERS 4
+
 namespace Components
 {
 	class Scheduler : public Component
@@ -8,6 +10,7 @@ namespace Components
 		enum class Pipeline : int
 		{
 			ASYNC,
+			ASYNC_IO, // Blocking work (HTTP, disk), spread over a few dedicated workers
 			RENDERER,
 			SERVER,
 			CLIENT,
@@ -46,18 +49,30 @@ namespace Components
 			void add(Task&& task);
 			void execute();
 
+			[[nodiscard]] std::size_t depth() const { return depth_; }
+			[[nodiscard]] std::size_t peakDepth() const { return peakDepth_; }
+			[[nodiscard]] bool busy() const { return busy_; }
+
 		private:
 			Utils::Concurrency::Container<taskList> newCallbacks_;
 			Utils::Concurrency::Container<taskList, std::recursive_mutex> callbacks_;
 
+			std::atomic<std::size_t> depth_{0};
+			std::atomic<std::size_t> peakDepth_{0};
+			std::atomic_bool busy_{false};
+
 			void mergeCallbacks();
 		};
 
 		static volatile bool Kill;
 		static std::thread Thread;
+		static std::thread IOThreads[SCHEDULER_IO_WORKERS];
 		static TaskPipeline Pipelines[];
+		static TaskPipeline IOPipelines[SCHEDULER_IO_WORKERS];
 
+		static TaskPipeline& GetPipeline(Pipeline type);
 		static void Execute(Pipeline type);
+		static void PrintStats();
 
 		static void ScrPlace_EndFrame_Hk();
 		static void ServerFrame_Hk();
@@ -14,6 +14,15 @@ namespace Components
 {
 	ServerInfo::Container ServerInfo::PlayerContainer;
 
+	ServerInfo::StatusCache ServerInfo::StatusResponseCache;
+	std::uint64_t ServerInfo::StatusCacheHits = 0;
+	std::uint64_t ServerInfo::StatusCacheMisses = 0;
+	Dvar::Var ServerInfo::SVStatusCacheTime;
+
+	Dvar::Var ServerInfo::SVQueryBurst;
+	Dvar::Var ServerInfo::SVQueryInterval;
+	Utils::RateLimiter ServerInfo::QueryRateLimit(16384, 10, 100);
+
 	unsigned int ServerInfo::GetPlayerCount()
 	{
 		return PlayerContainer.playerList.size();
@@ -183,10 +192,134 @@ namespace Components
 		return info;
 	}
 
+	void ServerInfo::ForEachStatusPlayer(const std::function<void(int score, int ping, const char* name)>& callback)
+	{
+		for (std::size_t i = 0; i < Game::MAX_CLIENTS; ++i)
+		{
+			if (Dedicated::IsRunning())
+			{
+				if (Game::svs_clients[i].header.state < Game::CS_ACTIVE) continue;
+				if (!Game::svs_clients[i].gentity || !Game::svs_clients[i].gentity->client) continue;
+
+				const auto* client = Game::svs_clients[i].gentity->client;
+				const auto team = client->sess.cs.team;
+				if (Game::svs_clients[i].bIsTestClient || team == Game::TEAM_SPECTATOR)
+				{
+					continue;
+				}
+
+				callback(Game::SV_GameClientNum_Score(static_cast<int>(i)), Game::svs_clients[i].ping, Game::svs_clients[i].name);
+			}
+			else
+			{
+				// Score and ping are irrelevant
+				const auto* namePtr = Game::PartyHost_GetMemberName(reinterpret_cast<Game::PartyData*>(0x1081C00), i);
+				if (!namePtr || !*namePtr) continue;
+
+				callback(0, 0, namePtr);
+			}
+		}
+	}
+
+	std::string ServerInfo::BuildStatusResponse(const std::string& challenge)
+	{
+		auto& cache = StatusResponseCache;
+
+		const auto now = Game::Sys_Milliseconds();
+		const auto cacheTime = SVStatusCacheTime.get<int>();
+
+		// Serverinfo dvars (hostname, gametype, ...) show up within sv_statusCacheTime, the fields clients rely on right away are checked directly
+		const auto* password = *Game::g_password ? (*Game::g_password)->current.string : "";
+		const auto infoKey = std::format("{}\\{}\\{}", (*Game::sv_mapname)->current.string, *Game::svs_clientCount, *password != '\0');
+
+		auto rebuilt = false;
+		if (!cache.infoValid || cache.infoKey != infoKey || now - cache.infoTime >= cacheTime)
+		{
+			cache.info = GetInfo().build();
+			cache.infoKey = infoKey;
+			cache.infoTime = now;
+			cache.infoValid = true;
+			rebuilt = true;
+		}
+
+		// Scores and pings change all the time, so the player list only goes by age
+		if (!cache.playerListValid || now - cache.playerListTime >= cacheTime)
+		{
+			cache.playerList.clear();
+
+			ForEachStatusPlayer([](const int score, const int ping, const char* name)
+			{
+				StatusResponseCache.playerList.append(std::format("{} {} \"{}\"\n", score, ping, name));
+			});
+
+			cache.playerListTime = now;
+			cache.playerListValid = true;
+			rebuilt = true;
+		}
+
+		if (rebuilt)
+		{
+			++StatusCacheMisses;
+		}
+		else
+		{
+			++StatusCacheHits;
+		}
+
+		std::string response;
+		response.reserve(cache.info.size() + challenge.size() + cache.playerList.size() + 16);
+		response.append(cache.info);
+		response.append("\\challenge\\");
+		response.append(challenge);
+		response.append("\n");
+		response.append(cache.playerList);
+		response.append("\n");
+
+		return response;
+	}
+
+	bool ServerInfo::IsQueryAllowed(const Network::Address& address)
+	{
+		return QueryRateLimit.allow(address.getIP().full, Game::Sys_Milliseconds());
+	}
+
 	ServerInfo::ServerInfo()
 	{
 		PlayerContainer.currentPlayer = 0;
 
+		SVQueryBurst = Dvar::Register<int>("sv_queryBurst", 10, 1, 1000, Game::DVAR_NONE, "Number of getinfo/getstatus queries a single IP may send in a burst");
+		SVQueryInterval = Dvar::Register<int>("sv_queryInterval", 100, 1, 60000, Game::DVAR_NONE, "Milliseconds it takes for a single IP to regain one getinfo/getstatus query");
+
+		QueryRateLimit.setLimits(SVQueryBurst.get<int>(), SVQueryInterval.get<int>());
+
+		SVStatusCacheTime = Dvar::Register<int>("sv_statusCacheTime", 1000, 0, 60000, Game::DVAR_NONE, "Milliseconds the serverinfo and player list of getstatus responses are cached for");
+
+		Command::Add("statusCacheStats", []
+		{
+			const auto total = StatusCacheHits + StatusCacheMisses;
+			Logger::Print("getstatus cache: {} hits, {} misses ({:.1f}% hit rate)\n", StatusCacheHits, StatusCacheMisses, total ? (100.0 * StatusCacheHits / total) : 0.0);
+		});
+
+		Command::Add("queryRateLimitStats", []
+		{
+			Logger::Print("getinfo/getstatus: {} allowed, {} dropped ({} evictions)\n", QueryRateLimit.getAllowed(), QueryRateLimit.getDropped(), QueryRateLimit.getEvicted());
+		});
+
+		// Only touch the limiter when the dvars change
+		Scheduler::Loop([]
+		{
+			static auto lastBurst = 0;
+			static auto lastInterval = 0;
+
+			const auto burst = SVQueryBurst.get<int>();
+			const auto interval = SVQueryInterval.get<int>();
+			if (burst == lastBurst && interval == lastInterval) return;
+
+			QueryRateLimit.setLimits(burst, interval);
+			lastBurst = burst;
+			lastInterval = interval;
+		}, Scheduler::Pipeline::MAIN, 1s);
+
 		// Draw IP and hostname on the scoreboard
 		Utils::Hook(0x4FC6EA, DrawScoreboardStub, HOOK_CALL).install()->quick();
 
@@ -201,46 +334,12 @@ namespace Components
 
 		Network::OnClientPacket("getStatus", [](const Network::Address& address, [[maybe_unused]] const std::string& data)
 		{
-			std::string playerList;
-
-			Utils::InfoString info = GetInfo();
-			info.set("challenge", Utils::ParseChallenge(data));
-
-			for (std::size_t i = 0; i < Game::MAX_CLIENTS; ++i)
+			if (!IsQueryAllowed(address))
 			{
-				auto score = 0;
-				auto ping = 0;
-				std::string name;
-
-				if (Dedicated::IsRunning())
-				{
-					if (Game::svs_clients[i].header.state < Game::CS_ACTIVE) continue;
-					if (!Game::svs_clients[i].gentity || !Game::svs_clients[i].gentity->client) continue;
-
-					const auto* client = Game::svs_clients[i].gentity->client;
-					const auto team = client->sess.cs.team;
-					if (Game::svs_clients[i].bIsTestClient || team == Game::TEAM_SPECTATOR)
-					{
-						continue;
-					}
-
-					score = Game::SV_GameClientNum_Score(static_cast<int>(i));
-					ping = Game::svs_clients[i].ping;
-					name = Game::svs_clients[i].name;
-				}
-				else
-				{
-					// Score and ping are irrelevant
-					const auto* namePtr = Game::PartyHost_GetMemberName(reinterpret_cast<Game::PartyData*>(0x1081C00), i);
-					if (!namePtr || !*namePtr) continue;
-
-					name = namePtr;
-				}
-
-				playerList.append(std::format("{} {} \"{}\"\n", score, ping, name));
+				return;
 			}
 
-			Network::SendCommand(address, "statusResponse", info.build() + "\n"s + playerList + "\n"s);
+			Network::SendCommand(address, "statusResponse", BuildStatusResponse(Utils::ParseChallenge(data)));
 		});
 
 		Network::OnClientPacket("statusResponse", [](const Network::Address& address, [[maybe_unused]] const std::string& data)
@@ -11,6 +11,8 @@ namespace Components
 		static Utils::InfoString GetHostInfo();
 		static Utils::InfoString GetInfo();
 
+		static bool IsQueryAllowed(const Network::Address& address);
+
 	private:
 		class Container
 		{
@@ -28,8 +30,33 @@ namespace Components
 			Network::Address target;
 		};
 
+		class StatusCache
+		{
+		public:
+			std::string info;
+			std::string infoKey;
+			int infoTime;
+			bool infoValid;
+
+			std::string playerList;
+			int playerListTime;
+			bool playerListValid;
+		};
+
 		static Container PlayerContainer;
 
+		static StatusCache StatusResponseCache;
+		static std::uint64_t StatusCacheHits;
+		static std::uint64_t StatusCacheMisses;
+		static Dvar::Var SVStatusCacheTime;
+
+		static Dvar::Var SVQueryBurst;
+		static Dvar::Var SVQueryInterval;
+		static Utils::RateLimiter QueryRateLimit;
+
+		static void ForEachStatusPlayer(const std::function<void(int score, int ping, const char* name)>& callback);
+		static std::string BuildStatusResponse(const std::string& challenge);
+
 		static void ServerStatus([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info);
 
 		static unsigned int GetPlayerCount();
@@ -5,6 +5,7 @@
 #include "Events.hpp"
 #include "Node.hpp"
 #include "Party.hpp"
+#include "Resolver.hpp"
 #include "ServerList.hpp"
 #include "TextRenderer.hpp"
 #include "Toast.hpp"
@@ -378,9 +379,6 @@ namespace Components
 		}
 		else if (IsOnlineList())
 		{
-			const auto masterPort = (*Game::com_masterPort)->current.unsignedInt;
-			const auto* masterServerName = (*Game::com_masterServerName)->current.string;
-
 			RefreshContainer.awatingList = true;
 			RefreshContainer.awaitTime = Game::Sys_Milliseconds();
 
@@ -401,7 +399,10 @@ namespace Components
 			ParseNewMasterServerResponse(reply);
 
 			// TODO: Figure out what to do with this. Leave it to avoid breaking other code
-			RefreshContainer.host = Network::Address(std::format("{}:{}", masterServerName, masterPort));
+			if (const auto master = Resolver::GetMasterServer(); master.has_value())
+			{
+				RefreshContainer.host = *master;
+			}
 		}
 		else if (IsFavouriteList())
 		{
@@ -15,7 +15,15 @@ namespace Components
 
 	std::unordered_map<std::string, Network::networkCallback> Session::PacketHandlers;
 
+	std::vector<std::thread> Session::Workers;
+	std::mutex Session::JobMutex;
+	std::condition_variable Session::JobCondition;
+	std::deque<Session::Job> Session::Jobs;
+
 	std::queue<std::pair<Network::Address, std::string>> Session::SignatureQueue;
+	std::queue<std::tuple<Network::Address, std::string, std::string>> Session::VerifiedQueue;
+
+	Utils::RateLimiter Session::RateLimit(4096, SESSION_REQUEST_LIMIT, 1000);
 
 	void Session::Send(const Network::Address& target, const std::string& command, const std::string& data)
 	{
@@ -103,32 +111,118 @@ namespace Components
 		}
 	}
 
-	void Session::HandleSignatures()
+	bool Session::QueueJob(Job&& job)
+	{
+		{
+			std::lock_guard _(Session::JobMutex);
+
+			// Under load drop the request, the peer's retry loop will ask again
+			if (Session::Jobs.size() >= SESSION_JOB_LIMIT) return false;
+
+			Session::Jobs.emplace_back(std::move(job));
+		}
+
+		Session::JobCondition.notify_one();
+		return true;
+	}
+
+	void Session::Worker()
 	{
-		while (!Session::SignatureQueue.empty())
+		Com_InitThreadData();
+
+		std::vector<Job> batch;
+		batch.reserve(SESSION_JOB_BATCH);
+
+		while (true)
 		{
-			std::unique_lock<std::recursive_mutex> lock(Session::Mutex);
-			auto signature = Session::SignatureQueue.front();
-			Session::SignatureQueue.pop();
+			{
+				std::unique_lock lock(Session::JobMutex);
+				Session::JobCondition.wait(lock, []
+				{
+					return Session::Terminate || !Session::Jobs.empty();
+				});
 
-			auto queue = Session::PacketQueue.find(signature.first);
-			if (queue == Session::PacketQueue.end()) continue;
+				if (Session::Terminate) break;
 
-			if (!queue->second.empty())
+				while (!Session::Jobs.empty() && batch.size() < SESSION_JOB_BATCH)
+				{
+					batch.emplace_back(std::move(Session::Jobs.front()));
+					Session::Jobs.pop_front();
+				}
+			}
+
+			for (const auto& job : batch)
 			{
-				std::shared_ptr<Session::Packet> packet = queue->second.front();
-				queue->second.pop();
-				lock.unlock();
+				if (job.type == Job::Type::Sign)
+				{
+					Proto::Session::Packet dataPacket;
+					dataPacket.set_publickey(Session::SignatureKey.getPublicKey());
+					dataPacket.set_signature(Utils::Cryptography::ECC::SignMessage(Session::SignatureKey, job.challenge));
+					dataPacket.set_command(job.packet->command);
+					dataPacket.set_data(job.packet->data);
+
+					std::lock_guard _(Session::Mutex);
+					Session::SignatureQueue.push({ job.address, dataPacket.SerializeAsString() });
+				}
+				else
+				{
+					Proto::Session::Packet dataPacket;
+					if (!dataPacket.ParseFromString(job.data)) continue;
+
+					Utils::Cryptography::ECC::Key publicKey;
+					publicKey.set(dataPacket.publickey());
+
+					if (!Utils::Cryptography::ECC::VerifyMessage(publicKey, job.challenge, dataPacket.signature())) continue;
+
+					std::lock_guard _(Session::Mutex);
+					Session::VerifiedQueue.push({ job.address, dataPacket.command(), dataPacket.data() });
+				}
+			}
+
+			batch.clear();
+		}
+	}
+
+	void Session::HandleSignatures()
+	{
+		std::queue<std::pair<Network::Address, std::string>> signatures;
+
+		{
+			std::lock_guard _(Session::Mutex);
+			signatures.swap(Session::SignatureQueue);
+		}
+
+		while (!signatures.empty())
+		{
+			const auto& [address, data] = signatures.front();
+			Network::SendCommand(address, "sessionFin", data);
+			signatures.pop();
+		}
+	}
+
+	void Session::HandleVerified()
+	{
+		std::queue<std::tuple<Network::Address, std::string, std::string>> verified;
+
+		{
+			std::lock_guard _(Session::Mutex);
+			verified.swap(Session::VerifiedQueue);
+		}
+
+		while (!verified.empty())
+		{
+			auto& [address, command, data] = verified.front();
 
-				Proto::Session::Packet dataPacket;
-				dataPacket.set_publickey(Session::SignatureKey.getPublicKey());
-				dataPacket.set_signature(Utils::Cryptography::ECC::SignMessage(Session::SignatureKey, signature.second));
-				dataPacket.set_command(packet->command);
-				dataPacket.set_data(packet->data);
+			Network::networkCallback callback;
 
-				Network::SendCommand(signature.first, "sessionFin", dataPacket.SerializeAsString());
-				std::this_thread::sleep_for(3ms);
+			{
+				std::lock_guard _(Session::Mutex);
+				const auto handler = Session::PacketHandlers.find(command);
+				if (handler != Session::PacketHandlers.end()) callback = handler->second;
 			}
+
+			if (callback) callback(address, data);
+			verified.pop();
 		}
 	}
 
@@ -139,6 +233,13 @@ namespace Components
 		//Scheduler::OnFrame(Session::RunFrame);
 
 		Session::Terminate = false;
+
+		const auto workerCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1, SESSION_MAX_WORKERS);
+		for (auto i = 0; i < workerCount; ++i)
+		{
+			Session::Workers.emplace_back(Session::Worker);
+		}
+
 		Session::Thread = std::thread([]()
 		{
 			Com_InitThreadData();
@@ -153,6 +254,8 @@ namespace Components
 
 		Network::OnPacket("sessionSyn", [](const Network::Address& address, [[maybe_unused]] const std::string& data)
 		{
+			if (!Session::RateLimit.allow(address.getIP().full, Game::Sys_Milliseconds())) return;
+
 			Session::Frame frame;
 			frame.challenge = Utils::Cryptography::Rand::GenerateChallenge();
 
@@ -165,32 +268,35 @@ namespace Components
 		Network::OnPacket("sessionAck", [](const Network::Address& address, [[maybe_unused]] const std::string& data)
 		{
 			std::lock_guard _(Session::Mutex);
-			Session::SignatureQueue.push({ address, data });
+
+			auto queue = Session::PacketQueue.find(address);
+			if (queue == Session::PacketQueue.end() || queue->second.empty()) return;
+
+			// The packet stays queued if the workers are saturated, RunFrame resends the syn on timeout
+			if (Session::QueueJob({ Job::Type::Sign, address, data, queue->second.front(), {} }))
+			{
+				queue->second.pop();
+			}
 		});
 
 		Network::OnPacket("sessionFin", [](Network::Address& address, [[maybe_unused]] const std::string& data)
 		{
-			std::lock_guard _(Session::Mutex);
-
-			auto frame = Session::Sessions.find(address);
-			if (frame == Session::Sessions.end()) return;
+			std::string challenge;
 
-			std::string challenge = frame->second.challenge;
-			Session::Sessions.erase(frame);
-
-			Proto::Session::Packet dataPacket;
-			if (!dataPacket.ParseFromString(data)) return;
-
-			Utils::Cryptography::ECC::Key publicKey;
-			publicKey.set(dataPacket.publickey());
+			{
+				std::lock_guard _(Session::Mutex);
 
-			if (!Utils::Cryptography::ECC::VerifyMessage(publicKey, challenge, dataPacket.signature())) return;
+				auto frame = Session::Sessions.find(address);
+				if (frame == Session::Sessions.end()) return;
 
-			auto handler = Session::PacketHandlers.find(dataPacket.command());
-			if (handler == Session::PacketHandlers.end()) return;
+				challenge = frame->second.challenge;
+				Session::Sessions.erase(frame);
+			}
 
-			handler->second(address, dataPacket.data());
+			Session::QueueJob({ Job::Type::Verify, address, challenge, nullptr, data });
 		});
+
+		Scheduler::Loop(Session::HandleVerified, Scheduler::Pipeline::MAIN);
 #endif
 	}
 
@@ -200,13 +306,30 @@ namespace Components
 		Session::PacketHandlers.clear();
 		Session::PacketQueue.clear();
 		Session::SignatureQueue = std::queue<std::pair<Network::Address, std::string>>();
+		Session::VerifiedQueue = std::queue<std::tuple<Network::Address, std::string, std::string>>();
 
 		Session::SignatureKey.free();
 	}
 
 	void Session::preDestroy()
 	{
-		Session::Terminate = true;
+		{
+			std::lock_guard _(Session::JobMutex);
+			Session::Terminate = true;
+		}
+
+		Session::JobCondition.notify_all();
+
+		for (auto& worker : Session::Workers)
+		{
+			if (worker.joinable())
+			{
+				worker.join();
+			}
+		}
+
+		Session::Workers.clear();
+
 		if (Session::Thread.joinable())
 		{
 			Session::Thread.join();
@@ -3,7 +3,12 @@
 #define SESSION_TIMEOUT (10 * 1000) //10s
 #define SESSION_MAX_RETRIES 3
 #define SESSION_REQUEST_LIMIT 10
+#define SESSION_JOB_LIMIT 256
+#define SESSION_JOB_BATCH 16
+#define SESSION_MAX_WORKERS 4
 
+// Sessions are compiled out, packets go straight to Network. The signed path, including
+// the signing worker pool, only builds once this is removed and has not been exercised.
 #define DISABLE_SESSION
 
 namespace Components
@@ -28,6 +33,22 @@ namespace Components
 			Utils::Time::Point creationPoint;
 		};
 
+		class Job
+		{
+		public:
+			enum class Type
+			{
+				Sign,
+				Verify,
+			};
+
+			Type type;
+			Network::Address address;
+			std::string challenge;
+			std::shared_ptr<Packet> packet; // Sign: the packet to send once signed
+			std::string data; // Verify: the received sessionFin payload
+		};
+
 		Session();
 		~Session();
 
@@ -47,9 +68,23 @@ namespace Components
 
 		static std::unordered_map<std::string, Network::networkCallback> PacketHandlers;
 
+		static std::vector<std::thread> Workers;
+		static std::mutex JobMutex;
+		static std::condition_variable JobCondition;
+		static std::deque<Job> Jobs;
+
+		// Signed packets waiting to be sent by the session thread
 		static std::queue<std::pair<Network::Address, std::string>> SignatureQueue;
+		// Verified packets waiting to be handed to their handlers on the main thread
+		static std::queue<std::tuple<Network::Address, std::string, std::string>> VerifiedQueue;
+
+		static Utils::RateLimiter RateLimit;
+
+		static bool QueueJob(Job&& job);
+		static void Worker();
 
 		static void RunFrame();
 		static void HandleSignatures();
+		static void HandleVerified();
 	};
 }
@@ -1,3 +1,4 @@
+#include "Events.hpp"
 #include "ServerCommands.hpp"
 #include "Stats.hpp"
 
@@ -5,6 +6,10 @@
 
 namespace Components
 {
+	char Stats::SentStats[STATS_BUFFER_SIZE];
+	bool Stats::SentStatsValid = false;
+	int Stats::SentStatsTime = 0;
+
 	std::int64_t* Stats::GetStatsID()
 	{
 		static std::int64_t id = 0x110000100001337;
@@ -22,9 +27,25 @@ namespace Components
 		// check if we're connected to a server...
 		if (*reinterpret_cast<std::uint32_t*>(0xB2C540) >= 7)
 		{
-			for (unsigned char i = 0; i < 7; ++i)
+			// get stat buffer
+			const char* statbuffer = nullptr;
+			if (Utils::Hook::Call<int(int)>(0x444CA0)(0))
 			{
-				Game::Com_Printf(0, "Sending stat packet %i to server.\n", i);
+				statbuffer = Utils::Hook::Call<char* (int)>(0x4C49F0)(0);
+			}
+
+			// The chunks go out as unacknowledged OOB packets, so every now and then send all of them again in case one got lost
+			const auto now = Game::Sys_Milliseconds();
+			if (SentStatsValid && now - SentStatsTime >= STATS_FULL_RESEND_INTERVAL)
+			{
+				SentStatsValid = false;
+			}
+
+			// The server keeps the chunks it already has, only send the ones that changed
+			const auto* previous = SentStatsValid ? SentStats : nullptr;
+			Utils::BufferDiff::ForEachChangedChunk(previous, statbuffer, STATS_BUFFER_SIZE, STAT_PACKET_SIZE, [&](const std::size_t index, const std::size_t offset, const std::size_t size)
+			{
+				Game::Com_Printf(0, "Sending stat packet %i to server.\n", static_cast<int>(index));
 
 				// alloc
 				Game::msg_t msg{};
@@ -34,27 +55,31 @@ namespace Components
 				Game::MSG_Init(&msg, buffer, sizeof(buffer));
 				Game::MSG_WriteString(&msg, "stats");
 
-				// get stat buffer
-				char* statbuffer = nullptr;
-				if (Utils::Hook::Call<int(int)>(0x444CA0)(0))
-				{
-					statbuffer = &Utils::Hook::Call<char* (int)>(0x4C49F0)(0)[1240 * i];
-				}
-
 				// Client port?
 				Game::MSG_WriteShort(&msg, *reinterpret_cast<short*>(0xA1E878));
 
 				// Stat packet index
-				Game::MSG_WriteByte(&msg, i);
+				Game::MSG_WriteByte(&msg, static_cast<int>(index));
 
 				// write stat packet data
 				if (statbuffer)
 				{
-					Game::MSG_WriteData(&msg, statbuffer, std::min(8192 - (i * 1240), 1240));
+					Game::MSG_WriteData(&msg, &statbuffer[offset], static_cast<int>(size));
 				}
 
 				// send statpacket
 				Network::SendRaw(Game::NS_CLIENT1, *reinterpret_cast<Game::netadr_t*>(0xA1E888), std::string(reinterpret_cast<char*>(msg.data), msg.cursize));
+			});
+
+			if (statbuffer)
+			{
+				if (!SentStatsValid)
+				{
+					SentStatsTime = now;
+				}
+
+				std::memcpy(SentStats, statbuffer, sizeof(SentStats));
+				SentStatsValid = true;
 			}
 		}
 	}
@@ -216,6 +241,12 @@ namespace Components
 		// allowing the player to change their classes while connected to a server.
 		UIScript::Add("UpdateClasses", UpdateClasses);
 
+		// A new connection starts from whatever the game uploads while connecting
+		Events::OnCLDisconnected([]([[maybe_unused]] bool wasConnected)
+		{
+			SentStatsValid = false;
+		});
+
 		// Allow playerdata to be changed while connected to a server
 		Utils::Hook::Set<BYTE>(0x4376FD, 0xEB);
 
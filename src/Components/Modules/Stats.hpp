@@ -10,6 +10,18 @@ namespace Components
 		static bool IsMaxLevel();
 
 	private:
+		static constexpr auto STATS_BUFFER_SIZE = 8192;
+		static constexpr auto STAT_PACKET_SIZE = 1240;
+		static constexpr auto STAT_PACKET_COUNT = 7;
+		static constexpr auto STATS_FULL_RESEND_INTERVAL = 10000;
+
+		static_assert(static_cast<std::size_t>(STAT_PACKET_COUNT) == Utils::BufferDiff::ChunkCount(STATS_BUFFER_SIZE, STAT_PACKET_SIZE));
+
+		// Copy of what we last sent on the current connection, the server never acknowledges it
+		static char SentStats[STATS_BUFFER_SIZE];
+		static bool SentStatsValid;
+		static int SentStatsTime;
+
 		static void UpdateClasses([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info);
 
 		static void SendStats();
@@ -78,6 +78,13 @@ namespace Components
 	TextRenderer::FontIconAutocompleteContext TextRenderer::autocompleteContextArray[FONT_ICON_ACI_COUNT];
 	std::map<std::string, TextRenderer::FontIconTableEntry> TextRenderer::fontIconLookup;
 	std::vector<TextRenderer::FontIconTableEntry> TextRenderer::fontIconList;
+	std::list<TextRenderer::TextWidthCacheEntry> TextRenderer::textWidthCacheList;
+	std::unordered_map<std::uint64_t, std::list<TextRenderer::TextWidthCacheEntry>::iterator> TextRenderer::textWidthCacheLookup;
+	std::atomic<std::uint32_t> TextRenderer::textWidthCacheGeneration = 0;
+	std::uint32_t TextRenderer::textWidthCacheSeenGeneration = 0;
+	std::atomic<std::thread::id> TextRenderer::textWidthCacheThread;
+	std::uint64_t TextRenderer::textWidthCacheHits;
+	std::uint64_t TextRenderer::textWidthCacheMisses;
 
 	TextRenderer::BufferedLocalizedString TextRenderer::stringHintAutoComplete(REFERENCE_HINT_AUTO_COMPLETE, STRING_BUFFER_SIZE_SMALL);
 	TextRenderer::BufferedLocalizedString TextRenderer::stringHintModifier(REFERENCE_HINT_MODIFIER, STRING_BUFFER_SIZE_SMALL);
@@ -160,6 +167,8 @@ namespace Components
 		inModifiers(false),
 		userClosed(false),
 		lastHash(0),
+		matchBegin(0),
+		matchEnd(0),
 		results{},
 		resultCount(0),
 		hasMoreResults(false),
@@ -263,38 +272,48 @@ namespace Components
 		context.hasMoreResults = false;
 		context.lastResultOffset = context.resultOffset;
 
-		auto skipCount = context.resultOffset;
+		const auto& query = context.lastQuery;
 
-		const auto queryLen = context.lastQuery.size();
-		for (const auto& fontIconEntry : fontIconList)
+		// fontIconList is sorted, so all matches form one contiguous range.
+		// When the user keeps typing, the new range lies within the previous one.
+		auto searchBegin = fontIconList.begin();
+		auto searchEnd = fontIconList.end();
+		if (!context.matchQuery.empty() && query.starts_with(context.matchQuery) && context.matchEnd <= fontIconList.size())
 		{
-			const auto compareValue = fontIconEntry.iconName.compare(0, queryLen, context.lastQuery);
+			searchBegin = fontIconList.begin() + context.matchBegin;
+			searchEnd = fontIconList.begin() + context.matchEnd;
+		}
 
-			if (compareValue == 0)
+		if (query != context.matchQuery)
+		{
+			const auto first = std::partition_point(searchBegin, searchEnd, [&](const FontIconTableEntry& entry)
 			{
-				if (skipCount > 0)
-				{
-					skipCount--;
-				}
-				else if (context.resultCount < FontIconAutocompleteContext::MAX_RESULTS)
-				{
-					context.results[context.resultCount++] =
-					{
-						Utils::String::VA(":%s:", fontIconEntry.iconName.data()),
-						fontIconEntry.iconName
-					};
-				}
-				else
-				{
-					context.hasMoreResults = true;
-				}
-			}
-			else if (compareValue > 0)
+				return entry.iconName.compare(0, query.size(), query) < 0;
+			});
+
+			const auto last = std::partition_point(first, searchEnd, [&](const FontIconTableEntry& entry)
 			{
-				break;
-			}
+				return entry.iconName.compare(0, query.size(), query) == 0;
+			});
+
+			context.matchBegin = first - fontIconList.begin();
+			context.matchEnd = last - fontIconList.begin();
+			context.matchQuery = query;
 		}
 
+		const auto matchCount = context.matchEnd - context.matchBegin;
+		for (auto i = context.resultOffset; i < matchCount && context.resultCount < FontIconAutocompleteContext::MAX_RESULTS; ++i)
+		{
+			const auto& fontIconEntry = fontIconList[context.matchBegin + i];
+			auto& result = context.results[context.resultCount++];
+
+			// Reuse the existing result buffers
+			result.fontIconName.assign(1, FONT_ICON_SEPARATOR_CHARACTER).append(fontIconEntry.iconName).push_back(FONT_ICON_SEPARATOR_CHARACTER);
+			result.materialName.assign(fontIconEntry.iconName);
+		}
+
+		context.hasMoreResults = context.resultOffset + context.resultCount < matchCount;
+
 		context.maxFontIconWidth = 0;
 		context.maxMaterialNameWidth = 0;
 		for (auto resultIndex = 0u; resultIndex < context.resultCount; resultIndex++)
@@ -1270,21 +1289,114 @@ namespace Components
 		}
 	}
 
-	int TextRenderer::R_TextWidth_Hk(const char* text, int maxChars, Game::Font_s* font)
+	bool TextRenderer::GetTextWidthCacheKey(const char* text, int maxChars, const Game::Font_s* font, std::uint64_t* key, std::size_t* length)
 	{
-		auto lineWidth = 0;
-		auto maxWidth = 0;
+		// FNV-1a over the text, mixed with the font and the char limit
+		auto hash = 0xCBF29CE484222325ull;
+		std::size_t i = 0;
+		for (; text[i]; ++i)
+		{
+			// Long strings and strings with digits (timers, scores, pings) change too often to be worth caching
+			if (i >= TEXT_WIDTH_CACHE_MAX_LENGTH || (text[i] >= '0' && text[i] <= '9' && (i == 0 || text[i - 1] != '^')))
+			{
+				return false;
+			}
+
+			hash = (hash ^ static_cast<unsigned char>(text[i])) * 0x100000001B3ull;
+		}
+
+		hash = (hash ^ reinterpret_cast<std::uintptr_t>(font)) * 0x100000001B3ull;
+		hash = (hash ^ static_cast<std::uint32_t>(maxChars)) * 0x100000001B3ull;
+
+		*key = hash;
+		*length = i;
+		return true;
+	}
+
+	void TextRenderer::InvalidateTextWidthCache()
+	{
+		++textWidthCacheGeneration;
+	}
+
+	bool TextRenderer::IsTextWidthCacheThread()
+	{
+		// The cache belongs to the first thread that measures text, other callers bypass it
+		const auto current = std::this_thread::get_id();
+		auto owner = textWidthCacheThread.load();
+		if (owner == std::thread::id() && textWidthCacheThread.compare_exchange_strong(owner, current))
+		{
+			return true;
+		}
 
+		return owner == current;
+	}
+
+	int TextRenderer::R_TextWidth_Hk(const char* text, int maxChars, Game::Font_s* font)
+	{
 		if (maxChars <= 0)
 		{
 			maxChars = std::numeric_limits<int>::max();
 		}
 
-		if (text == nullptr)
+		if (text == nullptr || font == nullptr)
 		{
 			return 0;
 		}
 
+		std::uint64_t key;
+		std::size_t length;
+		if (!IsTextWidthCacheThread() || !GetTextWidthCacheKey(text, maxChars, font, &key, &length))
+		{
+			return MeasureTextWidth(text, maxChars, font);
+		}
+
+		// Zones were loaded or unloaded, font pointers may have been reused
+		const auto generation = textWidthCacheGeneration.load();
+		if (generation != textWidthCacheSeenGeneration)
+		{
+			textWidthCacheLookup.clear();
+			textWidthCacheList.clear();
+			textWidthCacheSeenGeneration = generation;
+		}
+
+		auto itr = textWidthCacheLookup.find(key);
+		if (itr != textWidthCacheLookup.end())
+		{
+			const auto& entry = *itr->second;
+			if (entry.font == font && entry.maxChars == maxChars && entry.text.size() == length && std::memcmp(entry.text.data(), text, length) == 0)
+			{
+				textWidthCacheList.splice(textWidthCacheList.begin(), textWidthCacheList, itr->second);
+				++textWidthCacheHits;
+				return entry.width;
+			}
+		}
+
+		const auto width = MeasureTextWidth(text, maxChars, font);
+		++textWidthCacheMisses;
+
+		if (itr != textWidthCacheLookup.end())
+		{
+			// Hash collision, just replace the entry
+			textWidthCacheList.erase(itr->second);
+			textWidthCacheLookup.erase(itr);
+		}
+		else if (textWidthCacheList.size() >= TEXT_WIDTH_CACHE_SIZE)
+		{
+			textWidthCacheLookup.erase(textWidthCacheList.back().key);
+			textWidthCacheList.pop_back();
+		}
+
+		textWidthCacheList.push_front({ key, font, maxChars, std::string(text, length), width });
+		textWidthCacheLookup[key] = textWidthCacheList.begin();
+
+		return width;
+	}
+
+	int TextRenderer::MeasureTextWidth(const char* text, int maxChars, Game::Font_s* font)
+	{
+		auto lineWidth = 0;
+		auto maxWidth = 0;
+
 		auto count = 0;
 		while (text && *text && count < maxChars)
 		{
@@ -1670,6 +1782,15 @@ namespace Components
 		fontIconList.clear();
 		fontIconLookup.clear();
 
+		// Font icon widths depend on the loaded materials
+		InvalidateTextWidthCache();
+
+		for (auto& context : autocompleteContextArray)
+		{
+			context.matchQuery.clear();
+			context.lastHash = 0;
+		}
+
 		const auto fontIconTable = Game::DB_FindXAssetHeader(Game::ASSET_TYPE_STRINGTABLE, "mp/fonticons.csv").stringTable;
 
 		if (fontIconTable->columnCount < 2 || fontIconTable->rowCount <= 0)
@@ -1727,6 +1848,12 @@ namespace Components
 		// Consider material text icons and font icons when calculating text width
 		Utils::Hook(0x5056C0, R_TextWidth_Hk, HOOK_JUMP).install()->quick();
 
+		Command::Add("textWidthCacheStats", []
+		{
+			const auto total = textWidthCacheHits + textWidthCacheMisses;
+			Logger::Print("text width cache: {} hits, {} misses ({:.1f}% hit rate)\n", textWidthCacheHits, textWidthCacheMisses, total ? (100.0 * textWidthCacheHits / total) : 0.0);
+		});
+
 		// Patch ColorIndex
 		Utils::Hook(0x417770, ColorIndex, HOOK_JUMP).install()->quick();
 
@@ -146,6 +146,15 @@ namespace Components
 			unsigned char v;
 		};
 
+		struct TextWidthCacheEntry
+		{
+			std::uint64_t key;
+			const Game::Font_s* font;
+			int maxChars;
+			std::string text;
+			int width;
+		};
+
 		class FontIconAutocompleteResult
 		{
 		public:
@@ -179,6 +188,9 @@ namespace Components
 			bool userClosed;
 			unsigned int lastHash;
 			std::string lastQuery;
+			std::string matchQuery;
+			std::size_t matchBegin;
+			std::size_t matchEnd;
 			FontIconAutocompleteResult results[MAX_RESULTS];
 			size_t resultCount;
 			bool hasMoreResults;
@@ -206,6 +218,16 @@ namespace Components
 		static BufferedLocalizedString stringListFlipVertical;
 		static BufferedLocalizedString stringListBig;
 
+		static constexpr std::size_t TEXT_WIDTH_CACHE_SIZE = 2048;
+		static constexpr std::size_t TEXT_WIDTH_CACHE_MAX_LENGTH = 256;
+		static std::list<TextWidthCacheEntry> textWidthCacheList;
+		static std::unordered_map<std::uint64_t, std::list<TextWidthCacheEntry>::iterator> textWidthCacheLookup;
+		static std::atomic<std::uint32_t> textWidthCacheGeneration;
+		static std::uint32_t textWidthCacheSeenGeneration;
+		static std::atomic<std::thread::id> textWidthCacheThread;
+		static std::uint64_t textWidthCacheHits;
+		static std::uint64_t textWidthCacheMisses;
+
 		static Dvar::Var cg_newColors;
 		static Dvar::Var cg_fontIconAutocomplete;
 		static Dvar::Var cg_fontIconAutocompleteHint;
@@ -232,11 +254,18 @@ namespace Components
 
 		static bool HandleFontIconAutocompleteKey(int localClientNum, FontIconAutocompleteInstance autocompleteInstance, int key);
 
+		// Safe from any thread, the owning thread drops the cache on its next measurement
+		static void InvalidateTextWidthCache();
+
 		TextRenderer();
 
 	private:
 		static unsigned HsvToRgb(HsvColor hsv);
 
+		static int MeasureTextWidth(const char* text, int maxChars, Game::Font_s* font);
+		static bool GetTextWidthCacheKey(const char* text, int maxChars, const Game::Font_s* font, std::uint64_t* key, std::size_t* length);
+		static bool IsTextWidthCacheThread();
+
 		static void DrawAutocompleteBox(const FontIconAutocompleteContext& context, float x, float y, float w, float h, const float* color);
 		static void DrawAutocompleteModifiers(FontIconAutocompleteInstance instance, float x, float y, Game::Font_s* font, float textXScale, float textYScale);
 		static void DrawAutocompleteResults(FontIconAutocompleteInstance instance, float x, float y, Game::Font_s* font, float textXScale, float textYScale);
@@ -1,4 +1,6 @@
 
+#include <proto/theatre.pb.h>
+
 #include "Theatre.hpp"
 #include "UIFeeder.hpp"
 
@@ -7,9 +9,18 @@ namespace Components
 	Theatre::DemoInfo Theatre::CurrentInfo;
 	unsigned int Theatre::CurrentSelection;
 	std::vector<Theatre::DemoInfo> Theatre::Demos;
+	bool Theatre::CatalogLoaded = false;
+	std::int64_t Theatre::CatalogModified = 0;
 
 	Dvar::Var Theatre::CLAutoRecord;
 	Dvar::Var Theatre::CLDemosKeep;
+	Dvar::Var Theatre::CLDemoSeekSpeed;
+
+	std::string Theatre::PlaybackDemo;
+	int Theatre::PlaybackStartTime = 0;
+	int Theatre::SeekTarget = 0;
+	float Theatre::SeekTimescale = 1.0f;
+	int Theatre::SeekRestartTime = 0;
 
 	char Theatre::BaselineSnapshot[131072] = {0};
 	int Theatre::BaselineSnapshotMsgLen;
@@ -224,18 +235,216 @@ namespace Components
 		CurrentInfo.length = Game::Sys_Milliseconds() - CurrentInfo.length;
 
 		// Write metadata
-		FileSystem::FileWriter meta(std::format("{}.json", CurrentInfo.name));
-		meta.write(nlohmann::json(CurrentInfo.to_json()).dump());
+		{
+			FileSystem::FileWriter meta(std::format("{}.json", CurrentInfo.name));
+			meta.write(nlohmann::json(CurrentInfo.to_json()).dump());
+		}
+
+		// Writing the demo touched the directory, so patch the catalog in place and restamp it
+		if (CatalogLoaded)
+		{
+			auto demoInfo = CurrentInfo;
+			demoInfo.name = std::filesystem::path(CurrentInfo.name).stem().string();
+
+			RemoveFromCatalog(demoInfo.name);
+			Demos.push_back(demoInfo);
+			SortDemos();
+
+			SaveCatalog();
+		}
 	}
 
-	void Theatre::LoadDemos([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info)
+	void Theatre::UpdateSeek()
+	{
+		const auto* clc = Game::clientConnections;
+		if (!clc->demoplaying)
+		{
+			PlaybackDemo.clear();
+			PlaybackStartTime = 0;
+		}
+		else if (Game::clients->snap.valid && (!PlaybackStartTime || PlaybackDemo != clc->demoName))
+		{
+			// Seek targets are relative to the first snapshot of the demo
+			PlaybackDemo = clc->demoName;
+			PlaybackStartTime = Game::clients->snap.serverTime;
+		}
+
+		if (!SeekTarget) return;
+
+		auto timescale = Dvar::Var(const_cast<Game::dvar_t*>(*Game::com_timescale));
+
+		if (!Game::clientConnections->demoplaying)
+		{
+			// Playback was stopped mid-seek, unless we are waiting for a restarted demo to begin playing
+			if (!SeekRestartTime)
+			{
+				timescale.set(SeekTimescale);
+				SeekTarget = 0;
+			}
+
+			return;
+		}
+
+		if (!Game::clients->snap.valid) return;
+
+		if (SeekRestartTime)
+		{
+			// Old playback is still running until the queued demo command kicks in, the restarted one begins further back
+			if (Game::clients->snap.serverTime >= SeekRestartTime) return;
+			SeekRestartTime = 0;
+		}
+
+		if (Game::clients->snap.serverTime >= SeekTarget)
+		{
+			timescale.set(SeekTimescale);
+			SeekTarget = 0;
+
+			Logger::Print("Demo seek finished\n");
+			return;
+		}
+
+		timescale.set(CLDemoSeekSpeed.get<float>());
+	}
+
+	void Theatre::SeekDemo(const Command::Params* params)
+	{
+		if (!Game::clientConnections->demoplaying)
+		{
+			Logger::Print("Not playing a demo\n");
+			return;
+		}
+
+		if (params->size() < 2)
+		{
+			Logger::Print("Usage: {} <seconds from start>\n", params->get(0));
+			return;
+		}
+
+		if (!PlaybackStartTime)
+		{
+			Logger::Print("Demo playback has not started yet\n");
+			return;
+		}
+
+		const auto seconds = std::strtof(params->get(1), nullptr);
+		if (seconds < 0.0f)
+		{
+			Logger::Print("Seek target is outside of the demo\n");
+			return;
+		}
+
+		const auto target = PlaybackStartTime + static_cast<int>(seconds * 1000.0f);
+
+		if (!SeekTarget)
+		{
+			SeekTimescale = (*Game::com_timescale)->current.value;
+		}
+
+		SeekTarget = target;
+
+		// Demo snapshots are delta compressed against each other, going back means replaying from the start
+		if (target < Game::clients->snap.serverTime)
+		{
+			SeekRestartTime = Game::clients->snap.serverTime;
+
+			// Don't fast-forward the rest of the old playback, nor keep doing it if the restart fails
+			Dvar::Var(const_cast<Game::dvar_t*>(*Game::com_timescale)).set(SeekTimescale);
+
+			Command::Execute(std::format("demo {}", PlaybackDemo), false);
+		}
+
+		Logger::Print("Seeking to {}\n", Utils::String::FormatTimeSpan(target - PlaybackStartTime));
+	}
+
+	std::filesystem::path Theatre::GetDemoDirectory()
+	{
+		return std::filesystem::path((*Game::fs_basepath)->current.string) / Game::fs_gamedir / "demos";
+	}
+
+	std::int64_t Theatre::GetDemoDirectoryTime()
+	{
+		std::error_code ec;
+		const auto time = std::filesystem::last_write_time(GetDemoDirectory(), ec);
+		if (ec) return 0;
+
+		return time.time_since_epoch().count();
+	}
+
+	bool Theatre::LoadCatalog()
+	{
+		const auto directory = GetDemoDirectory();
+
+		std::string data;
+		if (!Utils::IO::ReadFile((directory.parent_path() / "demos.dat").string(), &data) || data.empty())
+		{
+			return false;
+		}
+
+		Proto::Theatre::Catalog catalog;
+		if (!catalog.ParseFromString(data))
+		{
+			return false;
+		}
+
+		if (catalog.directory() != directory.string() || catalog.modified() != GetDemoDirectoryTime())
+		{
+			return false;
+		}
+
+		Demos.clear();
+		Demos.reserve(catalog.demos_size());
+
+		for (const auto& demo : catalog.demos())
+		{
+			DemoInfo demoInfo;
+			demoInfo.name = demo.name();
+			demoInfo.mapname = demo.mapname();
+			demoInfo.gametype = demo.gametype();
+			demoInfo.author = demo.author();
+			demoInfo.length = demo.length();
+			demoInfo.timeStamp = static_cast<std::time_t>(demo.timestamp());
+
+			Demos.push_back(demoInfo);
+		}
+
+		CatalogLoaded = true;
+		CatalogModified = catalog.modified();
+		return true;
+	}
+
+	void Theatre::SaveCatalog()
+	{
+		if (!CatalogLoaded) return;
+
+		const auto directory = GetDemoDirectory();
+
+		Proto::Theatre::Catalog catalog;
+		catalog.set_directory(directory.string());
+		catalog.set_modified(GetDemoDirectoryTime());
+
+		for (const auto& demoInfo : Demos)
+		{
+			auto* demo = catalog.add_demos();
+			demo->set_name(demoInfo.name);
+			demo->set_mapname(demoInfo.mapname);
+			demo->set_gametype(demoInfo.gametype);
+			demo->set_author(demoInfo.author);
+			demo->set_length(demoInfo.length);
+			demo->set_timestamp(static_cast<std::int64_t>(demoInfo.timeStamp));
+		}
+
+		CatalogModified = catalog.modified();
+		Utils::IO::WriteFile((directory.parent_path() / "demos.dat").string(), catalog.SerializeAsString());
+	}
+
+	void Theatre::RebuildCatalog()
 	{
-		CurrentSelection = 0;
 		Demos.clear();
 
 		const auto demos = FileSystem::GetFileList("demos/", "dm_13");
+		Demos.reserve(demos.size());
 
-		for (auto demo : demos)
+		for (const auto& demo : demos)
 		{
 			if (FileSystem::File meta = std::format("demos/{}.json", demo))
 			{
@@ -262,8 +471,44 @@ namespace Components
 			}
 		}
 
-		// Reverse, latest demo first!
-		std::ranges::reverse(Demos);
+		SortDemos();
+
+		CatalogLoaded = true;
+		SaveCatalog();
+	}
+
+	void Theatre::SortDemos()
+	{
+		// Latest demo first!
+		std::ranges::sort(Demos, [](const DemoInfo& lhs, const DemoInfo& rhs) -> bool
+		{
+			if (lhs.timeStamp != rhs.timeStamp) return lhs.timeStamp > rhs.timeStamp;
+			return lhs.name > rhs.name;
+		});
+	}
+
+	void Theatre::RemoveFromCatalog(const std::string& name)
+	{
+		std::erase_if(Demos, [&name](const DemoInfo& demoInfo) -> bool
+		{
+			return demoInfo.name == name;
+		});
+	}
+
+	void Theatre::LoadDemos([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info)
+	{
+		CurrentSelection = 0;
+
+		// The in-memory catalog is good as long as nothing touched the demo directory behind our back
+		if (CatalogLoaded && CatalogModified == GetDemoDirectoryTime())
+		{
+			return;
+		}
+
+		if (!LoadCatalog())
+		{
+			RebuildCatalog();
+		}
 	}
 
 	void Theatre::DeleteDemo([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info)
@@ -277,6 +522,9 @@ namespace Components
 			FileSystem::_DeleteFile("demos", demoInfo.name + ".dm_13");
 			FileSystem::_DeleteFile("demos", demoInfo.name + ".dm_13.json");
 
+			RemoveFromCatalog(demoInfo.name);
+			SaveCatalog();
+
 			// Reset our ui_demo_* dvars here, because the theater menu needs it.
 			Dvar::Var("ui_demo_mapname").set("");
 			Dvar::Var("ui_demo_mapname_localized").set("");
@@ -359,6 +607,13 @@ namespace Components
 				Logger::Print("Deleting old demo {}\n", files[i]);
 				FileSystem::_DeleteFile("demos", files[i]);
 				FileSystem::_DeleteFile("demos", std::format("{}.json", files[i]));
+
+				RemoveFromCatalog(files[i].substr(0, files[i].find_last_of(".")));
+			}
+
+			if (numDel > 0)
+			{
+				SaveCatalog();
 			}
 
 			Command::Execute(Utils::String::VA("record auto_%lld", std::time(nullptr)), true);
@@ -391,6 +646,7 @@ namespace Components
 
 		CLAutoRecord = Dvar::Register<bool>("cl_autoRecord", true, Game::DVAR_ARCHIVE, "Automatically record games");
 		CLDemosKeep = Dvar::Register<int>("cl_demosKeep", 30, 1, 999, Game::DVAR_ARCHIVE, "How many demos to keep with autorecord");
+		CLDemoSeekSpeed = Dvar::Register<float>("cl_demoSeekSpeed", 20.0f, 1.0f, 100.0f, Game::DVAR_NONE, "Timescale used to fast-forward when seeking in a demo");
 
 		Utils::Hook(0x5A8370, GamestateWriteStub, HOOK_CALL).install()->quick();
 		Utils::Hook(0x5A85D2, RecordGamestateStub, HOOK_CALL).install()->quick();
@@ -412,6 +668,11 @@ namespace Components
 		Utils::Hook(0x5A1D6A, CL_FirstSnapshot_Stub, HOOK_CALL).install()->quick();
 		Utils::Hook(0x4A712A, SV_SpawnServer_Stub, HOOK_CALL).install()->quick();
 
+		// Demo seeking
+		Scheduler::Loop(UpdateSeek, Scheduler::Pipeline::CLIENT);
+
+		Command::Add("demoSeek", SeekDemo);
+
 		// UIScripts
 		UIScript::Add("loadDemos", LoadDemos);
 		UIScript::Add("launchDemo", PlayDemo);
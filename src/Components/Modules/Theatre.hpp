@@ -26,9 +26,18 @@ namespace Components
 		static DemoInfo CurrentInfo;
 		static unsigned int CurrentSelection;
 		static std::vector<DemoInfo> Demos;
+		static bool CatalogLoaded;
+		static std::int64_t CatalogModified;
 
 		static Dvar::Var CLAutoRecord;
 		static Dvar::Var CLDemosKeep;
+		static Dvar::Var CLDemoSeekSpeed;
+
+		static std::string PlaybackDemo;
+		static int PlaybackStartTime;
+		static int SeekTarget;
+		static float SeekTimescale;
+		static int SeekRestartTime;
 
 		static char BaselineSnapshot[131072];
 		static int BaselineSnapshotMsgLen;
@@ -37,6 +46,18 @@ namespace Components
 		static void WriteBaseline();
 		static void StoreBaseline(PBYTE snapshotMsg);
 
+		static std::filesystem::path GetDemoDirectory();
+		static std::int64_t GetDemoDirectoryTime();
+
+		static bool LoadCatalog();
+		static void SaveCatalog();
+		static void RebuildCatalog();
+		static void SortDemos();
+		static void RemoveFromCatalog(const std::string& name);
+
+		static void UpdateSeek();
+		static void SeekDemo(const Command::Params* params);
+
 		static void LoadDemos([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info);
 		static void DeleteDemo([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info);
 		static void PlayDemo([[maybe_unused]] const UIScript::Token& token, [[maybe_unused]] const Game::uiInfo_s* info);
@@ -72,7 +72,7 @@ namespace Components
 	Updater::Updater()
 	{
 		cl_updateAvailable = Game::Dvar_RegisterBool("cl_updateAvailable", false, Game::DVAR_NONE, "Whether an update is available or not");
-		Scheduler::Once(CheckForUpdate, Scheduler::Pipeline::ASYNC);
+		Scheduler::Once(CheckForUpdate, Scheduler::Pipeline::ASYNC_IO);
 
 		UIScript::Add("checkForUpdate", [](const UIScript::Token& /*token*/, const Game::uiInfo_s* /*info*/)
 		{
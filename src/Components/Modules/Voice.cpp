@@ -5,9 +5,20 @@
 
 namespace Components
 {
-	Game::VoicePacket_t Voice::VoicePackets[Game::MAX_CLIENTS][MAX_SERVER_QUEUED_VOICE_PACKETS];
+	Game::VoicePacket_t Voice::VoicePayloads[VOICE_PAYLOAD_RING_SIZE];
+	std::uint8_t Voice::VoicePayloadRefs[VOICE_PAYLOAD_RING_SIZE];
+	int Voice::VoicePayloadHead;
+
+	std::uint16_t Voice::VoicePackets[Game::MAX_CLIENTS][MAX_SERVER_QUEUED_VOICE_PACKETS];
 	int Voice::VoicePacketCount[Game::MAX_CLIENTS];
 
+	Voice::ListenerState Voice::ListenerStates[Game::MAX_CLIENTS];
+	std::uint32_t Voice::Audiences[Game::MAX_CLIENTS];
+	std::uint32_t Voice::AudienceValid;
+	int Voice::AudienceTime = -1;
+	bool Voice::AudienceAllTalk;
+	bool Voice::AudienceDeadChat;
+
 	bool Voice::MuteList[Game::MAX_CLIENTS];
 	bool Voice::S_PlayerMute[Game::MAX_CLIENTS];
 
@@ -19,6 +30,42 @@ namespace Components
 		return sv_voice->current.enabled;
 	}
 
+	int Voice::SV_AllocVoicePayload(const int talkerNum, const Game::VoicePacket_t* voicePacket)
+	{
+		for (auto i = 0; i < VOICE_PAYLOAD_RING_SIZE; ++i)
+		{
+			const auto index = (VoicePayloadHead + i) % VOICE_PAYLOAD_RING_SIZE;
+			if (VoicePayloadRefs[index])
+			{
+				continue;
+			}
+
+			auto* payload = &VoicePayloads[index];
+			payload->dataSize = voicePacket->dataSize;
+			std::memcpy(payload->data, voicePacket->data, voicePacket->dataSize);
+
+			assert(talkerNum == static_cast<std::uint8_t>(talkerNum));
+			payload->talker = static_cast<char>(talkerNum);
+
+			VoicePayloadHead = (index + 1) % VOICE_PAYLOAD_RING_SIZE;
+			return index;
+		}
+
+		assert(false && "Voice payload ring exhausted");
+		return -1;
+	}
+
+	void Voice::SV_ReleaseVoicePackets(const int clientNum)
+	{
+		for (auto packet = 0; packet < VoicePacketCount[clientNum]; ++packet)
+		{
+			assert(VoicePayloadRefs[VoicePackets[clientNum][packet]] > 0);
+			--VoicePayloadRefs[VoicePackets[clientNum][packet]];
+		}
+
+		VoicePacketCount[clientNum] = 0;
+	}
+
 	void Voice::SV_WriteVoiceDataToClient(const int clientNum, Game::msg_t* msg)
 	{
 		assert(VoicePacketCount[clientNum] >= 0);
@@ -27,12 +74,13 @@ namespace Components
 		Game::MSG_WriteByte(msg, VoicePacketCount[clientNum]);
 		for (auto packet = 0; packet < VoicePacketCount[clientNum]; ++packet)
 		{
-			Game::MSG_WriteByte(msg, VoicePackets[clientNum][packet].talker);
+			const auto* payload = &VoicePayloads[VoicePackets[clientNum][packet]];
+			Game::MSG_WriteByte(msg, payload->talker);
 
-			assert(VoicePackets[clientNum][packet].dataSize < (2 << 15));
+			assert(payload->dataSize < (2 << 15));
 
-			Game::MSG_WriteByte(msg, VoicePackets[clientNum][packet].dataSize);
-			Game::MSG_WriteData(msg, VoicePackets[clientNum][packet].data, VoicePackets[clientNum][packet].dataSize);
+			Game::MSG_WriteByte(msg, payload->dataSize);
+			Game::MSG_WriteData(msg, payload->data, payload->dataSize);
 		}
 
 		assert(!msg->overflowed);
@@ -65,7 +113,7 @@ namespace Components
 			else
 			{
 				Game::NET_OutOfBandVoiceData(Game::NS_SERVER, client->header.netchan.remoteAddress, msg.data, msg.cursize, true);
-				VoicePacketCount[clientNum] = 0;
+				SV_ReleaseVoicePackets(clientNum);
 			}
 		}
 	}
@@ -81,18 +129,21 @@ namespace Components
 	void Voice::SV_ClearMutedList()
 	{
 		std::memset(MuteList, 0, sizeof(MuteList));
+		AudienceValid = 0;
 	}
 
 	void Voice::SV_MuteClient(const int muteClientIndex)
 	{
 		AssertIn(muteClientIndex, Game::MAX_CLIENTS);
 		MuteList[muteClientIndex] = true;
+		AudienceValid &= ~(1u << muteClientIndex);
 	}
 
 	void Voice::SV_UnmuteClient(const int muteClientIndex)
 	{
 		AssertIn(muteClientIndex, Game::MAX_CLIENTS);
 		MuteList[muteClientIndex] = false;
+		AudienceValid &= ~(1u << muteClientIndex);
 	}
 
 	bool Voice::SV_ServerHasClientMuted(const int talker)
@@ -116,77 +167,142 @@ namespace Components
 		return false;
 	}
 
-	void Voice::SV_QueueVoicePacket(const int talkerNum, const int clientNum, const Game::VoicePacket_t* voicePacket)
+	bool Voice::SV_CanHear(const Game::gentity_s* talker, const Game::gentity_s* ent)
 	{
-		assert(talkerNum >= 0);
-		assert(clientNum >= 0);
-		assert(talkerNum < (*Game::sv_maxclients)->current.integer);
-		assert(clientNum < (*Game::sv_maxclients)->current.integer);
-
-		if (VoicePacketCount[clientNum] < MAX_SERVER_QUEUED_VOICE_PACKETS)
+		const auto* client = ent->client;
+		if (!ent->r.isInUse || !client || talker == ent)
 		{
-			VoicePackets[clientNum][VoicePacketCount[clientNum]].dataSize = voicePacket->dataSize;
-			std::memcpy(VoicePackets[clientNum][VoicePacketCount[clientNum]].data, voicePacket->data, voicePacket->dataSize);
+			return false;
+		}
 
-			assert(talkerNum == static_cast<std::uint8_t>(talkerNum));
-			VoicePackets[clientNum][VoicePacketCount[clientNum]].talker = static_cast<char>(talkerNum);
-			++VoicePacketCount[clientNum];
+		const auto canCommunicate = client->sess.sessionState == Game::SESS_STATE_INTERMISSION
+			|| OnSameTeam(talker, ent)
+			|| talker->client->sess.cs.team == Game::TEAM_FREE
+			|| sv_alltalk->current.enabled;
+
+		if (!canCommunicate)
+		{
+			return false;
 		}
+
+		return client->sess.sessionState == talker->client->sess.sessionState
+			|| ((client->sess.sessionState == Game::SESS_STATE_DEAD || talker->client->sess.sessionState == Game::SESS_STATE_DEAD) && (*Game::g_deadChat)->current.enabled)
+			|| sv_alltalk->current.enabled;
 	}
 
-	void Voice::G_BroadcastVoice(Game::gentity_s* talker, const Game::VoicePacket_t* voicePacket)
+	void Voice::SV_RefreshAudienceState()
 	{
-		for (auto otherPlayer = 0; otherPlayer < (*Game::sv_maxclients)->current.integer; ++otherPlayer)
+		// Everything the audience rules depend on only changes between server frames
+		if (AudienceTime == *Game::svs_time)
 		{
-			auto* ent = &Game::g_entities[otherPlayer];
-			auto* client = ent->client;
+			return;
+		}
 
-			bool shouldSendVoicePacket = false;
+		AudienceTime = *Game::svs_time;
 
-			if (ent->r.isInUse && client) {
-				bool canCommunicate = false;
+		auto changed = AudienceAllTalk != sv_alltalk->current.enabled || AudienceDeadChat != (*Game::g_deadChat)->current.enabled;
+		AudienceAllTalk = sv_alltalk->current.enabled;
+		AudienceDeadChat = (*Game::g_deadChat)->current.enabled;
 
-				if (client->sess.sessionState == Game::SESS_STATE_INTERMISSION) {
-					canCommunicate = true;
-				}
-				else if (OnSameTeam(talker, ent)) {
-					canCommunicate = true;
-				}
-				else if (talker->client->sess.cs.team == Game::TEAM_FREE) {
-					canCommunicate = true;
-				}
-				else if (sv_alltalk->current.enabled) {
-					canCommunicate = true;
+		for (std::size_t i = 0; i < Game::MAX_CLIENTS; ++i)
+		{
+			ListenerState state{};
+
+			if (static_cast<int>(i) < (*Game::sv_maxclients)->current.integer)
+			{
+				const auto* ent = &Game::g_entities[i];
+				if (ent->r.isInUse && ent->client)
+				{
+					state.inUse = true;
+					state.team = ent->client->sess.cs.team;
+					state.sessionState = ent->client->sess.sessionState;
 				}
+			}
+
+			if (ListenerStates[i] != state)
+			{
+				ListenerStates[i] = state;
+				changed = true;
+			}
+		}
 
-				if (canCommunicate) {
-					bool sessionStatesCompatible = false;
-
-					if (ent->client->sess.sessionState == talker->client->sess.sessionState) {
-						sessionStatesCompatible = true;
-					}
-					else if ((ent->client->sess.sessionState == Game::SESS_STATE_DEAD ||
-						talker->client->sess.sessionState == Game::SESS_STATE_DEAD) &&
-						(*Game::g_deadChat)->current.enabled) {
-						sessionStatesCompatible = true;
-					}
-					else if (sv_alltalk->current.enabled) {
-						sessionStatesCompatible = true;
-					}
-
-					bool isNotSelf = (talker != ent);
-					bool isNotMuted = !SV_ServerHasClientMuted(talker->s.number);
-
-					shouldSendVoicePacket = sessionStatesCompatible && isNotSelf && isNotMuted;
+		if (changed)
+		{
+			AudienceValid = 0;
+		}
+	}
+
+	std::uint32_t Voice::SV_GetAudience(const Game::gentity_s* talker)
+	{
+		const auto talkerNum = talker->s.number;
+		AssertIn(talkerNum, (*Game::sv_maxclients)->current.integer);
+
+		SV_RefreshAudienceState();
+
+		const auto bit = 1u << talkerNum;
+		if (AudienceValid & bit)
+		{
+			return Audiences[talkerNum];
+		}
+
+		std::uint32_t audience = 0;
+		if (!SV_ServerHasClientMuted(talkerNum))
+		{
+			for (auto otherPlayer = 0; otherPlayer < (*Game::sv_maxclients)->current.integer; ++otherPlayer)
+			{
+				if (SV_CanHear(talker, &Game::g_entities[otherPlayer]))
+				{
+					audience |= 1u << otherPlayer;
 				}
 			}
+		}
+
+		Audiences[talkerNum] = audience;
+		AudienceValid |= bit;
+		return audience;
+	}
+
+	void Voice::SV_QueueVoicePacket(std::uint32_t audience, const int talkerNum, const Game::VoicePacket_t* voicePacket)
+	{
+		assert(talkerNum >= 0);
+		assert(talkerNum < (*Game::sv_maxclients)->current.integer);
+
+		// Listeners with a full queue don't take a reference
+		for (auto clientNum = 0; clientNum < (*Game::sv_maxclients)->current.integer; ++clientNum)
+		{
+			if (VoicePacketCount[clientNum] >= MAX_SERVER_QUEUED_VOICE_PACKETS)
+			{
+				audience &= ~(1u << clientNum);
+			}
+		}
+
+		if (!audience)
+		{
+			return;
+		}
+
+		// The payload is stored once and every listener's queue references it
+		const auto payload = SV_AllocVoicePayload(talkerNum, voicePacket);
+		if (payload < 0)
+		{
+			return;
+		}
 
-			if (shouldSendVoicePacket) {
-				SV_QueueVoicePacket(talker->s.number, otherPlayer, voicePacket);
+		for (auto clientNum = 0; audience; ++clientNum, audience >>= 1)
+		{
+			if (audience & 1)
+			{
+				VoicePackets[clientNum][VoicePacketCount[clientNum]++] = static_cast<std::uint16_t>(payload);
+				++VoicePayloadRefs[payload];
 			}
 		}
 	}
 
+	void Voice::G_BroadcastVoice(Game::gentity_s* talker, const Game::VoicePacket_t* voicePacket)
+	{
+		SV_QueueVoicePacket(SV_GetAudience(talker), talker->s.number, voicePacket);
+	}
+
 	void Voice::SV_UserVoice(Game::client_s* cl, Game::msg_t* msg)
 	{
 		Game::VoicePacket_t voicePacket{};
@@ -247,13 +363,21 @@ namespace Components
 			assert(voicePacket.data);
 
 			Game::MSG_ReadData(msg, voicePacket.data, voicePacket.dataSize);
+			if (SV_ServerHasClientMuted(talker))
+			{
+				continue;
+			}
+
+			std::uint32_t audience = 0;
 			for (auto otherPlayer = 0; otherPlayer < (*Game::sv_maxclients)->current.integer; ++otherPlayer)
 			{
-				if (otherPlayer != talker && Game::svs_clients[otherPlayer].header.state >= Game::CS_CONNECTED && !SV_ServerHasClientMuted(talker))
+				if (otherPlayer != talker && Game::svs_clients[otherPlayer].header.state >= Game::CS_CONNECTED)
 				{
-					SV_QueueVoicePacket(talker, otherPlayer, &voicePacket);
+					audience |= 1u << otherPlayer;
 				}
 			}
+
+			SV_QueueVoicePacket(audience, talker, &voicePacket);
 		}
 	}
 
@@ -423,6 +547,8 @@ namespace Components
 	{
 		AssertOffset(Game::clientUIActive_t, connectionState, 0x9B8);
 
+		std::memset(VoicePayloads, 0, sizeof(VoicePayloads));
+		std::memset(VoicePayloadRefs, 0, sizeof(VoicePayloadRefs));
 		std::memset(VoicePackets, 0, sizeof(VoicePackets));
 		std::memset(VoicePacketCount, 0, sizeof(VoicePacketCount));
 
@@ -430,7 +556,11 @@ namespace Components
 		CL_ClearMutedList();
 
 		Events::OnSteamDisconnect(CL_ClearMutedList);
-		Events::OnClientDisconnect(SV_UnmuteClient);
+		Events::OnClientDisconnect([](const int clientNum) -> void
+		{
+			SV_UnmuteClient(clientNum);
+			SV_ReleaseVoicePackets(clientNum);
+		});
 		Events::OnClientConnect([](const Game::client_s* cl) -> void
 		{
 			if (Chat::IsMuted(cl))
@@ -17,15 +17,43 @@ namespace Components
 		static constexpr auto MAX_VOICE_PACKET_DATA = 256;
 		static constexpr auto MAX_SERVER_QUEUED_VOICE_PACKETS = 40;
 
-		static Game::VoicePacket_t VoicePackets[Game::MAX_CLIENTS][MAX_SERVER_QUEUED_VOICE_PACKETS];
+		// Every queue slot can reference a distinct payload, so the ring can never run out
+		static constexpr auto VOICE_PAYLOAD_RING_SIZE = static_cast<int>(Game::MAX_CLIENTS) * MAX_SERVER_QUEUED_VOICE_PACKETS;
+
+		static_assert(Game::MAX_CLIENTS <= 32, "Audience masks must fit in 32 bits");
+
+		struct ListenerState
+		{
+			bool inUse;
+			int team;
+			int sessionState;
+
+			bool operator==(const ListenerState&) const = default;
+		};
+
+		static Game::VoicePacket_t VoicePayloads[VOICE_PAYLOAD_RING_SIZE];
+		static std::uint8_t VoicePayloadRefs[VOICE_PAYLOAD_RING_SIZE];
+		static int VoicePayloadHead;
+
+		static std::uint16_t VoicePackets[Game::MAX_CLIENTS][MAX_SERVER_QUEUED_VOICE_PACKETS];
 		static int VoicePacketCount[Game::MAX_CLIENTS];
 
+		static ListenerState ListenerStates[Game::MAX_CLIENTS];
+		static std::uint32_t Audiences[Game::MAX_CLIENTS];
+		static std::uint32_t AudienceValid;
+		static int AudienceTime;
+		static bool AudienceAllTalk;
+		static bool AudienceDeadChat;
+
 		static bool MuteList[Game::MAX_CLIENTS];
 		static bool S_PlayerMute[Game::MAX_CLIENTS];
 
 		static const Game::dvar_t* sv_voice;
 		static const Game::dvar_t* sv_alltalk;
 
+		static int SV_AllocVoicePayload(int talkerNum, const Game::VoicePacket_t* voicePacket);
+		static void SV_ReleaseVoicePackets(int clientNum);
+
 		static void SV_WriteVoiceDataToClient(int clientNum, Game::msg_t* msg);
 		static void SV_SendClientVoiceData(Game::client_s* client);
 		static void SV_SendClientMessages_Stub(Game::client_s* client, Game::msg_t* msg, unsigned char* snapshotMsgBuf);
@@ -33,7 +61,10 @@ namespace Components
 		static bool SV_ServerHasClientMuted(int talker);
 
 		static bool OnSameTeam(const Game::gentity_s* ent1, const Game::gentity_s* ent2);
-		static void SV_QueueVoicePacket(int talkerNum, int clientNum, const Game::VoicePacket_t* voicePacket);
+		static bool SV_CanHear(const Game::gentity_s* talker, const Game::gentity_s* ent);
+		static void SV_RefreshAudienceState();
+		static std::uint32_t SV_GetAudience(const Game::gentity_s* talker);
+		static void SV_QueueVoicePacket(std::uint32_t audience, int talkerNum, const Game::VoicePacket_t* voicePacket);
 		static void G_BroadcastVoice(Game::gentity_s* talker, const Game::VoicePacket_t* voicePacket);
 		static void SV_UserVoice(Game::client_s* cl, Game::msg_t* msg);
 		static void SV_PreGameUserVoice(Game::client_s* cl, Game::msg_t* msg);
@@ -22,6 +22,10 @@ namespace Components
 	std::mutex ZW3Auth::StateMutex{};
 	ZW3Auth::DiscordFlowState ZW3Auth::DiscordFlow{};
 
+	std::mutex ZW3Auth::RequestMutex{};
+	std::unordered_map<std::string, std::vector<ZW3Auth::RequestCallback>> ZW3Auth::PendingRequests{};
+	std::atomic<std::uint32_t> ZW3Auth::RequestGeneration{0};
+
 	Dvar::Var ZW3Auth::Username;
 	Dvar::Var ZW3Auth::Password;
 	Dvar::Var ZW3Auth::RegisterUsername;
@@ -198,79 +202,162 @@ namespace Components
 		return Utils::String::Format("{} {}", GetTokenType(), GetAccessToken());
 	}
 
-	void ZW3Auth::StartLogin()
+	void ZW3Auth::SendRequest(const RequestMethod method, const std::string& url, const std::string& body, const RequestCallback& callback)
 	{
-		GuestMode = false;
-
-		const auto username = Username.get<std::string>();
-		const auto password = Password.get<std::string>();
+		const auto generation = RequestGeneration.load();
+		const auto key = std::format("{}|{}|{}|{}", generation, static_cast<int>(method), url, body);
 
-		if (username.empty() || password.empty())
 		{
-			Toast::Show(kAuthToastImage, "Authentication", "Username and password are required.", 3500);
-			return;
-		}
+			std::lock_guard _(RequestMutex);
 
-		Scheduler::Once([username, password]()
+			// An identical request is already in flight, share its result
+			if (const auto itr = PendingRequests.find(key); itr != PendingRequests.end())
 			{
-				const auto url = BuildUrl(kDefaultLoginPath);
-				const auto body = BuildJson({
-					{"email", username},
-					{"password", password},
-					{"device_guid", GetDeviceGuid()},
-					});
+				itr->second.push_back(callback);
+				return;
+			}
 
-				Utils::WebIO webio("zw3-auth");
+			PendingRequests[key].push_back(callback);
+		}
+
+		Scheduler::Once([=]
+			{
 				bool success = false;
-				const auto response = webio.setTimeout(10000)->post(url, body, &success);
+				const auto response = PerformRequest(method, url, body, &success);
 
-				Scheduler::Once([success, response]()
+				Scheduler::Once([=]
 					{
-						Password.set("");
+						std::vector<RequestCallback> callbacks;
 
-						if (!success || response.empty())
 						{
-							Toast::Show(kAuthToastImage, "Authentication", "Login failed. Service unreachable.", 3500);
-							return;
-						}
+							std::lock_guard _(RequestMutex);
+							const auto itr = PendingRequests.find(key);
+							if (itr == PendingRequests.end())
+							{
+								return;
+							}
 
-						rapidjson::Document document;
-						if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
-						{
-							Toast::Show(kAuthToastImage, "Authentication", "Login failed. Invalid response.", 3500);
-							return;
+							callbacks = std::move(itr->second);
+							PendingRequests.erase(itr);
 						}
 
-						if (const auto error = GetString(document, "error"))
+						// Signed out while the request was running
+						if (generation != RequestGeneration)
 						{
-							Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
 							return;
 						}
 
-						if (const auto accessToken = GetString(document, "access_token"))
+						for (const auto& cb : callbacks)
 						{
-							AccessToken = accessToken.value();
+							cb(success, response);
 						}
+					}, Scheduler::Pipeline::MAIN);
+			}, Scheduler::Pipeline::ASYNC_IO);
+	}
 
-						if (const auto sessionToken = GetString(document, "session_token"))
-						{
-							AccessToken = sessionToken.value();
-							TokenType = "Bearer";
-						}
+	std::string ZW3Auth::PerformRequest(const RequestMethod method, const std::string& url, const std::string& body, bool* success)
+	{
+		// Idle clients are reused so their WinINet sessions keep connections alive between requests.
+		// Each request holds its own client, a slow poll never blocks login or the other IO workers.
+		static std::mutex poolMutex;
+		static std::vector<std::unique_ptr<Utils::WebIO>> idleClients;
 
-						if (const auto refreshToken = GetString(document, "refresh_token"))
-						{
-							RefreshToken = refreshToken.value();
-						}
+		std::unique_ptr<Utils::WebIO> client;
 
-						if (const auto tokenType = GetString(document, "token_type"))
-						{
-							TokenType = tokenType.value();
-						}
+		{
+			std::lock_guard _(poolMutex);
+			if (!idleClients.empty())
+			{
+				client = std::move(idleClients.back());
+				idleClients.pop_back();
+			}
+		}
 
-						Toast::Show(kAuthToastImage, "Authentication", "Login successful.", 3500);
-					}, Scheduler::Pipeline::MAIN);
-			}, Scheduler::Pipeline::ASYNC);
+		if (!client)
+		{
+			client = std::make_unique<Utils::WebIO>("zw3-auth");
+		}
+
+		client->setTimeout(10000);
+
+		auto response = method == RequestMethod::Post ? client->post(url, body, success) : client->get(url, success);
+
+		std::lock_guard _(poolMutex);
+		idleClients.push_back(std::move(client));
+
+		return response;
+	}
+
+	std::chrono::milliseconds ZW3Auth::GetPollJitter()
+	{
+		return std::chrono::milliseconds(Utils::Cryptography::Rand::GenerateInt() % 1000);
+	}
+
+	void ZW3Auth::StartLogin()
+	{
+		GuestMode = false;
+
+		const auto username = Username.get<std::string>();
+		const auto password = Password.get<std::string>();
+
+		if (username.empty() || password.empty())
+		{
+			Toast::Show(kAuthToastImage, "Authentication", "Username and password are required.", 3500);
+			return;
+		}
+
+		const auto body = BuildJson({
+			{"email", username},
+			{"password", password},
+			{"device_guid", GetDeviceGuid()},
+			});
+
+		SendRequest(RequestMethod::Post, BuildUrl(kDefaultLoginPath), body, [](const bool success, const std::string& response)
+			{
+				Password.set("");
+
+				if (!success || response.empty())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Login failed. Service unreachable.", 3500);
+					return;
+				}
+
+				rapidjson::Document document;
+				if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Login failed. Invalid response.", 3500);
+					return;
+				}
+
+				if (const auto error = GetString(document, "error"))
+				{
+					Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
+					return;
+				}
+
+				if (const auto accessToken = GetString(document, "access_token"))
+				{
+					AccessToken = accessToken.value();
+				}
+
+				if (const auto sessionToken = GetString(document, "session_token"))
+				{
+					AccessToken = sessionToken.value();
+					TokenType = "Bearer";
+				}
+
+				if (const auto refreshToken = GetString(document, "refresh_token"))
+				{
+					RefreshToken = refreshToken.value();
+				}
+
+				if (const auto tokenType = GetString(document, "token_type"))
+				{
+					TokenType = tokenType.value();
+				}
+
+				Toast::Show(kAuthToastImage, "Authentication", "Login successful.", 3500);
+			});
 	}
 
 	void ZW3Auth::StartRegister()
@@ -287,46 +374,38 @@ namespace Components
 			return;
 		}
 
-		Scheduler::Once([username, email, password]()
-			{
-				const auto url = BuildUrl("/v1/auth/register");
-				const auto body = BuildJson({
-					{"username", username},
-					{"email", email},
-					{"password", password},
-					{"device_guid", GetDeviceGuid()},
-					});
-
-				Utils::WebIO webio("zw3-auth");
-				bool success = false;
-				const auto response = webio.setTimeout(10000)->post(url, body, &success);
+		const auto body = BuildJson({
+			{"username", username},
+			{"email", email},
+			{"password", password},
+			{"device_guid", GetDeviceGuid()},
+			});
 
-				Scheduler::Once([success, response]()
-					{
-						RegisterPassword.set("");
+		SendRequest(RequestMethod::Post, BuildUrl("/v1/auth/register"), body, [](const bool success, const std::string& response)
+			{
+				RegisterPassword.set("");
 
-						if (!success || response.empty())
-						{
-							Toast::Show(kAuthToastImage, "Authentication", "Registration failed. Please try again.", 3500);
-							return;
-						}
+				if (!success || response.empty())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Registration failed. Please try again.", 3500);
+					return;
+				}
 
-						rapidjson::Document document;
-						if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
-						{
-							Toast::Show(kAuthToastImage, "Authentication", "Registration failed. Invalid response.", 3500);
-							return;
-						}
+				rapidjson::Document document;
+				if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Registration failed. Invalid response.", 3500);
+					return;
+				}
 
-						if (const auto error = GetString(document, "error"))
-						{
-							Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
-							return;
-						}
+				if (const auto error = GetString(document, "error"))
+				{
+					Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
+					return;
+				}
 
-						Toast::Show(kAuthToastImage, "Authentication", "Registration complete. Check your email to activate.", 4000);
-					}, Scheduler::Pipeline::MAIN);
-			}, Scheduler::Pipeline::ASYNC);
+				Toast::Show(kAuthToastImage, "Authentication", "Registration complete. Check your email to activate.", 4000);
+			});
 	}
 
 	void ZW3Auth::StartActivation()
@@ -340,42 +419,34 @@ namespace Components
 			return;
 		}
 
-		Scheduler::Once([code]()
-			{
-				const auto url = BuildUrl("/v1/auth/activate");
-				const auto body = BuildJson({
-					{"code", code},
-					{"device_guid", GetDeviceGuid()},
-					});
-
-				Utils::WebIO webio("zw3-auth");
-				bool success = false;
-				const auto response = webio.setTimeout(10000)->post(url, body, &success);
+		const auto body = BuildJson({
+			{"code", code},
+			{"device_guid", GetDeviceGuid()},
+			});
 
-				Scheduler::Once([success, response]()
-					{
-						if (!success || response.empty())
-						{
-							Toast::Show(kAuthToastImage, "Authentication", "Activation failed. Please try again.", 3500);
-							return;
-						}
+		SendRequest(RequestMethod::Post, BuildUrl("/v1/auth/activate"), body, [](const bool success, const std::string& response)
+			{
+				if (!success || response.empty())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Activation failed. Please try again.", 3500);
+					return;
+				}
 
-						rapidjson::Document document;
-						if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
-						{
-							Toast::Show(kAuthToastImage, "Authentication", "Activation failed. Invalid response.", 3500);
-							return;
-						}
+				rapidjson::Document document;
+				if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Activation failed. Invalid response.", 3500);
+					return;
+				}
 
-						if (const auto error = GetString(document, "error"))
-						{
-							Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
-							return;
-						}
+				if (const auto error = GetString(document, "error"))
+				{
+					Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
+					return;
+				}
 
-						Toast::Show(kAuthToastImage, "Authentication", "Activation successful. You can sign in now.", 3500);
-					}, Scheduler::Pipeline::MAIN);
-			}, Scheduler::Pipeline::ASYNC);
+				Toast::Show(kAuthToastImage, "Authentication", "Activation successful. You can sign in now.", 3500);
+			});
 	}
 
 	void ZW3Auth::StartDiscord()
@@ -387,95 +458,103 @@ namespace Components
 				SetDiscordLock(true, "Waiting for Discord authorization...");
 			}, Scheduler::Pipeline::MAIN);
 
-		Scheduler::Once([]()
-			{
-				const auto startUrl = BuildUrl(kDefaultDiscordStartPath)
-					+ BuildQuery({ {"mode", "launcher"}, {"device_guid", GetDeviceGuid()} });
-				std::optional<std::string> fallbackState;
+		const auto startUrl = BuildUrl(kDefaultDiscordStartPath)
+			+ BuildQuery({ {"mode", "launcher"}, {"device_guid", GetDeviceGuid()} });
 
-				Utils::WebIO webio("zw3-auth");
-				bool success = false;
-				auto response = webio.setTimeout(10000)->get(startUrl, &success);
-
-				if (!success || response.empty())
+		SendRequest(RequestMethod::Get, startUrl, {}, [](const bool success, const std::string& response)
+			{
+				if (success && !response.empty())
 				{
-					const auto ticketUrl = BuildUrl(kDefaultStartTicketPath);
-					const auto body = BuildJson({
-						{"device_guid", GetDeviceGuid()},
-						});
-
-					success = false;
-					response = webio.setTimeout(10000)->post(ticketUrl, body, &success);
-					if (success && !response.empty())
-					{
-						rapidjson::Document ticketDoc;
-						if (!ticketDoc.Parse(response.c_str()).HasParseError() && ticketDoc.IsObject())
-						{
-							if (const auto ticket = GetString(ticketDoc, "start_ticket"))
-							{
-								const auto startWithTicket = BuildUrl(kDefaultDiscordStartPath)
-									+ BuildQuery({ {"mode", "launcher"}, {"device_guid", GetDeviceGuid()}, {"start_ticket", ticket.value()} });
-								success = false;
-								response = webio.setTimeout(10000)->get(startWithTicket, &success);
-							}
-							if (const auto state = GetString(ticketDoc, "state"))
-							{
-								fallbackState = state.value();
-							}
-						}
-					}
+					OnDiscordStarted(success, response, std::nullopt);
+					return;
 				}
 
-				Scheduler::Once([success, response, fallbackState]()
+				// Fall back to requesting a start ticket first
+				const auto body = BuildJson({
+					{"device_guid", GetDeviceGuid()},
+					});
+
+				SendRequest(RequestMethod::Post, BuildUrl(kDefaultStartTicketPath), body, [](const bool ticketSuccess, const std::string& ticketResponse)
 					{
-						if (!success || response.empty())
+						rapidjson::Document ticketDoc;
+						if (!ticketSuccess || ticketResponse.empty() || ticketDoc.Parse(ticketResponse.c_str()).HasParseError() || !ticketDoc.IsObject())
 						{
-							Toast::Show(kAuthToastImage, "Authentication", "Discord start failed. Service unreachable.", 3500);
+							OnDiscordStarted(ticketSuccess, ticketResponse, std::nullopt);
 							return;
 						}
 
-						rapidjson::Document document;
-						if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
+						std::optional<std::string> fallbackState;
+						if (const auto state = GetString(ticketDoc, "state"))
 						{
-							Toast::Show(kAuthToastImage, "Authentication", "Discord start failed. Invalid response.", 3500);
-							return;
+							fallbackState = state.value();
 						}
 
-						if (const auto error = GetString(document, "error"))
+						const auto ticket = GetString(ticketDoc, "start_ticket");
+						if (!ticket.has_value())
 						{
-							Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
+							OnDiscordStarted(ticketSuccess, ticketResponse, fallbackState);
 							return;
 						}
 
-						const auto state = GetString(document, "state");
-						const auto urlValue = GetString(document, "url");
-						const auto interval = GetInt(document, "interval");
-						const auto expiresIn = GetInt(document, "expires_in");
+						const auto startWithTicket = BuildUrl(kDefaultDiscordStartPath)
+							+ BuildQuery({ {"mode", "launcher"}, {"device_guid", GetDeviceGuid()}, {"start_ticket", ticket.value()} });
 
-						if ((!state.has_value() && !fallbackState.has_value()) || !urlValue.has_value())
-						{
-							Toast::Show(kAuthToastImage, "Authentication", "Discord start failed. Missing state.", 3500);
-							return;
-						}
+						SendRequest(RequestMethod::Get, startWithTicket, {}, [fallbackState](const bool startSuccess, const std::string& startResponse)
+							{
+								OnDiscordStarted(startSuccess, startResponse, fallbackState);
+							});
+					});
+			});
+	}
 
-						DiscordTicket = state.value_or(*fallbackState);
-						DiscordUrl = urlValue.value();
+	void ZW3Auth::OnDiscordStarted(const bool success, const std::string& response, const std::optional<std::string>& fallbackState)
+	{
+		if (!success || response.empty())
+		{
+			Toast::Show(kAuthToastImage, "Authentication", "Discord start failed. Service unreachable.", 3500);
+			return;
+		}
 
-						auto now = std::chrono::steady_clock::now();
-						{
-							std::lock_guard<std::mutex> lock(StateMutex);
-							DiscordFlow.active = true;
-							DiscordFlow.state = DiscordTicket;
-							DiscordFlow.url = urlValue.value();
-							DiscordFlow.intervalSeconds = interval.value_or(5);
-							DiscordFlow.expiresAt = now + std::chrono::seconds(expiresIn.value_or(600));
-							DiscordFlow.nextPoll = now + std::chrono::seconds(DiscordFlow.intervalSeconds);
-						}
+		rapidjson::Document document;
+		if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
+		{
+			Toast::Show(kAuthToastImage, "Authentication", "Discord start failed. Invalid response.", 3500);
+			return;
+		}
 
-						Toast::Show(kAuthToastImage, "Authentication", "Discord connection started.", 3500);
-						OpenDiscordUrl();
-					}, Scheduler::Pipeline::MAIN);
-			}, Scheduler::Pipeline::ASYNC);
+		if (const auto error = GetString(document, "error"))
+		{
+			Toast::Show(kAuthToastImage, "Authentication", error.value(), 3500);
+			return;
+		}
+
+		const auto state = GetString(document, "state");
+		const auto urlValue = GetString(document, "url");
+		const auto interval = GetInt(document, "interval");
+		const auto expiresIn = GetInt(document, "expires_in");
+
+		if ((!state.has_value() && !fallbackState.has_value()) || !urlValue.has_value())
+		{
+			Toast::Show(kAuthToastImage, "Authentication", "Discord start failed. Missing state.", 3500);
+			return;
+		}
+
+		DiscordTicket = state.value_or(*fallbackState);
+		DiscordUrl = urlValue.value();
+
+		auto now = std::chrono::steady_clock::now();
+		{
+			std::lock_guard<std::mutex> lock(StateMutex);
+			DiscordFlow.active = true;
+			DiscordFlow.state = DiscordTicket;
+			DiscordFlow.url = urlValue.value();
+			DiscordFlow.intervalSeconds = interval.value_or(5);
+			DiscordFlow.expiresAt = now + std::chrono::seconds(expiresIn.value_or(600));
+			DiscordFlow.nextPoll = now + std::chrono::seconds(DiscordFlow.intervalSeconds) + GetPollJitter();
+		}
+
+		Toast::Show(kAuthToastImage, "Authentication", "Discord connection started.", 3500);
+		OpenDiscordUrl();
 	}
 
 	void ZW3Auth::PollDiscord()
@@ -510,136 +589,133 @@ namespace Components
 		}
 
 		const auto state = flowCopy.state;
-		Scheduler::Once([state]()
+		const auto url = BuildUrl(kDefaultDiscordPollPath) + BuildQuery({
+			{"state", state},
+			});
+
+		SendRequest(RequestMethod::Get, url, {}, [state](const bool success, const std::string& response)
 			{
-				const auto url = BuildUrl(kDefaultDiscordPollPath) + BuildQuery({
-					{"state", state},
-					});
+				OnDiscordPolled(state, success, response);
+			});
 
-				Utils::WebIO webio("zw3-auth");
-				bool success = false;
-				const auto response = webio.setTimeout(10000)->get(url, &success);
+		{
+			std::lock_guard<std::mutex> lock(StateMutex);
+			DiscordFlow.nextPoll = now + std::chrono::seconds(DiscordFlow.intervalSeconds) + GetPollJitter();
+		}
+	}
 
-				Scheduler::Once([success, response, state]()
-					{
-						if (!success || response.empty())
-						{
-							return;
-						}
+	void ZW3Auth::OnDiscordPolled(const std::string& state, const bool success, const std::string& response)
+	{
+		if (!success || response.empty())
+		{
+			return;
+		}
 
-						rapidjson::Document document;
-						if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
-						{
-							return;
-						}
+		rapidjson::Document document;
+		if (document.Parse(response.c_str()).HasParseError() || !document.IsObject())
+		{
+			return;
+		}
 
-						if (const auto error = GetString(document, "error"))
-						{
-							if (*error == "authorization_pending")
-							{
-								return;
-							}
+		if (const auto error = GetString(document, "error"))
+		{
+			if (*error == "authorization_pending")
+			{
+				return;
+			}
 
-							if (*error == "slow_down")
-							{
-								std::lock_guard<std::mutex> lock(StateMutex);
-								DiscordFlow.intervalSeconds += 5;
-								DiscordFlow.nextPoll = std::chrono::steady_clock::now() + std::chrono::seconds(DiscordFlow.intervalSeconds);
-								return;
-							}
+			if (*error == "slow_down")
+			{
+				std::lock_guard<std::mutex> lock(StateMutex);
+				DiscordFlow.intervalSeconds += 5;
+				DiscordFlow.nextPoll = std::chrono::steady_clock::now() + std::chrono::seconds(DiscordFlow.intervalSeconds) + GetPollJitter();
+				return;
+			}
 
-							if (*error == "access_denied" || *error == "cancelled" || *error == "expired_token")
-							{
-								std::lock_guard<std::mutex> lock(StateMutex);
-								DiscordFlow = {};
-								SetDiscordLock(false, "Discord authorization cancelled.");
-								return;
-							}
+			if (*error == "access_denied" || *error == "cancelled" || *error == "expired_token")
+			{
+				std::lock_guard<std::mutex> lock(StateMutex);
+				DiscordFlow = {};
+				SetDiscordLock(false, "Discord authorization cancelled.");
+				return;
+			}
 
-							return;
-						}
+			return;
+		}
 
-						if (const auto needsUsername = document.HasMember("needs_username") && document["needs_username"].IsBool()
-							? std::optional<bool>(document["needs_username"].GetBool())
-							: std::nullopt)
-						{
-							if (*needsUsername)
-							{
-								const auto desired = Username.get<std::string>();
-								if (desired.empty())
-								{
-									Toast::Show(kAuthToastImage, "Authentication", "Enter a username to finish Discord login.", 3500);
-									return;
-								}
-
-								const auto setUrl = BuildUrl("/v1/auth/discord/username");
-								const auto body = BuildJson({
-									{"state", state},
-									{"username", desired},
-									});
-
-								Utils::WebIO setWebio("zw3-auth");
-								bool setSuccess = false;
-								setWebio.setTimeout(10000)->post(setUrl, body, &setSuccess);
-								if (!setSuccess)
-								{
-									Toast::Show(kAuthToastImage, "Authentication", "Could not save Discord username.", 3500);
-								}
-								return;
-							}
-						}
+		if (const auto needsUsername = document.HasMember("needs_username") && document["needs_username"].IsBool()
+			? std::optional<bool>(document["needs_username"].GetBool())
+			: std::nullopt)
+		{
+			if (*needsUsername)
+			{
+				const auto desired = Username.get<std::string>();
+				if (desired.empty())
+				{
+					Toast::Show(kAuthToastImage, "Authentication", "Enter a username to finish Discord login.", 3500);
+					return;
+				}
 
-						const auto ok = document.HasMember("ok") && document["ok"].IsBool()
-							? document["ok"].GetBool()
-							: false;
+				const auto body = BuildJson({
+					{"state", state},
+					{"username", desired},
+					});
 
-						if (ok)
+				SendRequest(RequestMethod::Post, BuildUrl("/v1/auth/discord/username"), body, [](const bool setSuccess, [[maybe_unused]] const std::string& setResponse)
+					{
+						if (!setSuccess)
 						{
-							if (const auto sessionToken = GetString(document, "session_token"))
-							{
-								AccessToken = sessionToken.value();
-								TokenType = "Bearer";
-							}
-						}
-						else
-						{
-							return;
+							Toast::Show(kAuthToastImage, "Authentication", "Could not save Discord username.", 3500);
 						}
+					});
+				return;
+			}
+		}
 
-						if (const auto refreshToken = GetString(document, "refresh_token"))
-						{
-							RefreshToken = refreshToken.value();
-						}
+		const auto ok = document.HasMember("ok") && document["ok"].IsBool()
+			? document["ok"].GetBool()
+			: false;
 
-						if (const auto tokenType = GetString(document, "token_type"))
-						{
-							TokenType = tokenType.value();
-						}
+		if (ok)
+		{
+			if (const auto sessionToken = GetString(document, "session_token"))
+			{
+				AccessToken = sessionToken.value();
+				TokenType = "Bearer";
+			}
+		}
+		else
+		{
+			return;
+		}
 
-						if (!AccessToken.empty())
-						{
-							if (const auto accountLabel = GetString(document, "account_label"))
-							{
-								if (!accountLabel->empty())
-								{
-									Command::Execute(Utils::String::VA("name \"%s\"", accountLabel->c_str()), false);
-								}
-							}
+		if (const auto refreshToken = GetString(document, "refresh_token"))
+		{
+			RefreshToken = refreshToken.value();
+		}
 
-							SetDiscordLock(false, "Discord connected.");
-						}
+		if (const auto tokenType = GetString(document, "token_type"))
+		{
+			TokenType = tokenType.value();
+		}
 
-						std::lock_guard<std::mutex> lock(StateMutex);
-						if (!AccessToken.empty())
-						{
-							DiscordFlow = {};
-						}
-					}, Scheduler::Pipeline::MAIN);
-			}, Scheduler::Pipeline::ASYNC);
+		if (!AccessToken.empty())
+		{
+			if (const auto accountLabel = GetString(document, "account_label"))
+			{
+				if (!accountLabel->empty())
+				{
+					Command::Execute(Utils::String::VA("name \"%s\"", accountLabel->c_str()), false);
+				}
+			}
+
+			SetDiscordLock(false, "Discord connected.");
+		}
 
+		std::lock_guard<std::mutex> lock(StateMutex);
+		if (!AccessToken.empty())
 		{
-			std::lock_guard<std::mutex> lock(StateMutex);
-			DiscordFlow.nextPoll = now + std::chrono::seconds(DiscordFlow.intervalSeconds);
+			DiscordFlow = {};
 		}
 	}
 
@@ -657,6 +733,9 @@ namespace Components
 
 	void ZW3Auth::Logout()
 	{
+		// Results of requests still in flight are dropped
+		++RequestGeneration;
+
 		AccessToken.clear();
 		RefreshToken.clear();
 		TokenType = "Bearer";
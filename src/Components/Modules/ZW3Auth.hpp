@@ -25,6 +25,14 @@ namespace Components
 			std::chrono::steady_clock::time_point expiresAt;
 		};
 
+		enum class RequestMethod
+		{
+			Get,
+			Post,
+		};
+
+		using RequestCallback = std::function<void(bool success, const std::string& response)>;
+
 		static void Initialize();
 		static void RegisterCommands();
 		static void RegisterScripts();
@@ -34,11 +42,17 @@ namespace Components
 		static void StartActivation();
 		static void StartDiscord();
 		static void PollDiscord();
+		static void OnDiscordStarted(bool success, const std::string& response, const std::optional<std::string>& fallbackState);
+		static void OnDiscordPolled(const std::string& state, bool success, const std::string& response);
 		static void OpenDiscordUrl();
 		static void Logout();
 		static void PlayAsGuest();
 		static bool IsGuest();
 
+		static void SendRequest(RequestMethod method, const std::string& url, const std::string& body, const RequestCallback& callback);
+		static std::string PerformRequest(RequestMethod method, const std::string& url, const std::string& body, bool* success);
+		static std::chrono::milliseconds GetPollJitter();
+
 		static std::string BuildUrl(const std::string& path);
 		static std::string BuildJson(const std::vector<std::pair<std::string, std::string>>& values);
 		static std::string UrlEncode(const std::string& input);
@@ -51,6 +65,10 @@ namespace Components
 		static std::mutex StateMutex;
 		static DiscordFlowState DiscordFlow;
 
+		static std::mutex RequestMutex;
+		static std::unordered_map<std::string, std::vector<RequestCallback>> PendingRequests;
+		static std::atomic<std::uint32_t> RequestGeneration;
+
 		static Dvar::Var Username;
 		static Dvar::Var Password;
 		static Dvar::Var RegisterUsername;
@@ -131,6 +131,8 @@ namespace Components
 		Logger::Print("Linking assets...\n");
 		if (!this->loadAssets()) return;
 
+		this->printLoadTimes();
+
 		this->addBranding();
 
 		Logger::Print("Saving...\n");
@@ -254,14 +256,18 @@ namespace Components
 		// Fix forward slashes for FXEffectDef (and probably other assets)
 		std::replace(name.begin(), name.end(), '\\', '/');
 
-		if (this->findAsset(type, name) != -1 || this->findSubAsset(type, name).data) return true;
-
 		if (type == Game::XAssetType::ASSET_TYPE_INVALID || type >= Game::XAssetType::ASSET_TYPE_COUNT)
 		{
 			Logger::Error(Game::ERR_FATAL, "Invalid asset type '{}'\n", typeName);
 			return false;
 		}
 
+		if (this->findAsset(type, name) != -1 || this->findSubAsset(type, name).data) return true;
+
+		// Time spent in nested loads is attributed to the nested asset types
+		const auto start = std::chrono::steady_clock::now();
+		const auto nestedStart = this->measuredLoadTime;
+
 		Game::XAssetHeader assetHeader = AssetHandler::FindAssetForZone(type, name, this, isSubAsset);
 
 		if (!assetHeader.data)
@@ -277,64 +283,88 @@ namespace Components
 		// Handle script strings
 		AssetHandler::ZoneMark(asset, this);
 
-		if (isSubAsset)
+		this->trackAsset(asset, isSubAsset);
+
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		this->loadTime[type] += elapsed - (this->measuredLoadTime - nestedStart);
+		++this->loadCount[type];
+		this->measuredLoadTime = nestedStart + elapsed;
+
+		return true;
+	}
+
+	void ZoneBuilder::Zone::trackAsset(const Game::XAsset& asset, bool isSubAsset)
+	{
+		auto& assets = isSubAsset ? this->loadedSubAssets : this->loadedAssets;
+		auto& index = isSubAsset ? this->subAssetIndex[asset.type] : this->assetIndex[asset.type];
+
+		if (const auto* assetName = Game::DB_GetXAssetName(&asset))
 		{
-			this->loadedSubAssets.push_back(asset);
+			if (assetName[0] == ',' && assetName[1] != '\0') ++assetName;
+
+			// Keep the first asset on duplicates, like the linear search did
+			index.emplace(assetName, static_cast<int>(assets.size()));
 		}
-		else
+
+		assets.push_back(asset);
+	}
+
+	void ZoneBuilder::Zone::printLoadTimes() const
+	{
+		std::vector<std::pair<std::chrono::steady_clock::duration, int>> times;
+		for (auto type = 0; type < Game::XAssetType::ASSET_TYPE_COUNT; ++type)
 		{
-			this->loadedAssets.push_back(asset);
+			if (this->loadCount[type]) times.emplace_back(this->loadTime[type], type);
 		}
 
+		std::ranges::sort(times, std::greater());
 
-		return true;
+		Logger::Print("Asset load times:\n");
+		for (const auto& [time, type] : times)
+		{
+			Logger::Print("  {:<24} {:>6} assets {:>10.2f} ms\n", Game::DB_GetXAssetTypeName(static_cast<Game::XAssetType>(type)), this->loadCount[type],
+				std::chrono::duration<double, std::milli>(time).count());
+		}
 	}
 
 	int ZoneBuilder::Zone::findAsset(Game::XAssetType type, std::string name)
 	{
-		if (name[0] == ',') name.erase(name.begin());
+		if (type < 0 || type >= Game::XAssetType::ASSET_TYPE_COUNT) return -1;
 
-		for (unsigned int i = 0; i < this->loadedAssets.size(); ++i)
-		{
-			Game::XAsset* asset = &this->loadedAssets[i];
+		if (name[0] == ',') name.erase(name.begin());
 
-			if (asset->type != type) continue;
+		const auto& index = this->assetIndex[type];
 
-			const auto* assetName = Game::DB_GetXAssetName(asset);
-			if (!assetName) return -1;
-			if (assetName[0] == ',' && assetName[1] != '\0') ++assetName;
+		auto result = -1;
+		if (const auto itr = index.find(name); itr != index.end())
+		{
+			result = itr->second;
+		}
 
-			if (this->getAssetName(type, assetName) == name)
-			{
-				return i;
-			}
+		// Assets also match under their new name
+		for (const auto& [oldName, newName] : this->renameMap[type])
+		{
+			if (newName != name) continue;
 
-			if (name == assetName)
+			if (const auto itr = index.find(oldName); itr != index.end() && (result == -1 || itr->second < result))
 			{
-				return i;
+				result = itr->second;
 			}
 		}
 
-		return -1;
+		return result;
 	}
 
 	Game::XAssetHeader ZoneBuilder::Zone::findSubAsset(Game::XAssetType type, std::string name)
 	{
+		if (type < 0 || type >= Game::XAssetType::ASSET_TYPE_COUNT) return { nullptr };
+
 		if (name[0] == ',') name.erase(name.begin());
 
-		for (unsigned int i = 0; i < this->loadedSubAssets.size(); ++i)
+		const auto& index = this->subAssetIndex[type];
+		if (const auto itr = index.find(name); itr != index.end())
 		{
-			Game::XAsset* asset = &this->loadedSubAssets[i];
-
-			if (asset->type != type) continue;
-
-			const char* assetName = Game::DB_GetXAssetName(asset);
-			if (assetName[0] == ',') ++assetName;
-
-			if (name == assetName)
-			{
-				return asset->header;
-			}
+			return this->loadedSubAssets[itr->second].header;
 		}
 
 		return { nullptr };
@@ -564,7 +594,7 @@ namespace Components
 
 		Game::XAssetHeader header = { &this->branding };
 		Game::XAsset brandingAsset = { Game::ASSET_TYPE_RAWFILE, header };
-		this->loadedAssets.push_back(brandingAsset);
+		this->trackAsset(brandingAsset, false);
 	}
 
 	// Check if the given pointer has already been mapped
@@ -627,6 +657,7 @@ namespace Components
 			if (this->scriptStrings.empty())
 			{
 				this->scriptStrings.push_back("");
+				this->scriptStringIndex.emplace("", 1);
 			}
 
 			return 0;
@@ -642,6 +673,7 @@ namespace Components
 		}
 
 		this->scriptStrings.push_back(str);
+		this->scriptStringIndex.emplace(str, static_cast<int>(this->scriptStrings.size()));
 		this->scriptStringMap[gameIndex] = this->scriptStrings.size();
 		return this->scriptStrings.size();
 	}
@@ -649,12 +681,10 @@ namespace Components
 	// Find a local scriptString
 	int ZoneBuilder::Zone::findScriptString(const std::string& str)
 	{
-		for (unsigned int i = 0; i < this->scriptStrings.size(); ++i)
+		const auto itr = this->scriptStringIndex.find(str);
+		if (itr != this->scriptStringIndex.end())
 		{
-			if (this->scriptStrings[i] == str)
-			{
-				return (i + 1);
-			}
+			return itr->second;
 		}
 
 		return -1;
@@ -662,7 +692,7 @@ namespace Components
 
 	void ZoneBuilder::Zone::addRawAsset(Game::XAssetType type, void* ptr)
 	{
-		this->loadedAssets.push_back({ type, {ptr} });
+		this->trackAsset({ type, {ptr} }, false);
 	}
 
 	// Remap a scriptString to it's corresponding value in the local scriptString table.
@@ -91,6 +91,9 @@ namespace Components
 
 			void addBranding();
 
+			void trackAsset(const Game::XAsset& asset, bool isSubAsset);
+			void printLoadTimes() const;
+
 			iw4of::params_t getIW4OfApiParams();
 
 			uint32_t safeGetPointer(const void* pointer);
@@ -111,6 +114,15 @@ namespace Components
 			std::vector<Game::XAsset> loadedSubAssets;
 			std::vector<std::string> scriptStrings;
 
+			// Name lookups for the vectors above, findAsset/findScriptString used to scan them linearly
+			std::unordered_map<std::string, int> assetIndex[Game::XAssetType::ASSET_TYPE_COUNT];
+			std::unordered_map<std::string, int> subAssetIndex[Game::XAssetType::ASSET_TYPE_COUNT];
+			std::unordered_map<std::string, int> scriptStringIndex;
+
+			std::chrono::steady_clock::duration loadTime[Game::XAssetType::ASSET_TYPE_COUNT]{};
+			unsigned int loadCount[Game::XAssetType::ASSET_TYPE_COUNT]{};
+			std::chrono::steady_clock::duration measuredLoadTime{};
+
 			std::map<unsigned short, unsigned int> scriptStringMap;
 
 			std::map<std::string, std::string> renameMap[Game::XAssetType::ASSET_TYPE_COUNT];
@@ -22,16 +22,20 @@
 #include <dbghelp.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <cinttypes>
 #include <cmath>
+#include <condition_variable>
 #include <cstring>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <future>
 #include <limits>
+#include <list>
+#include <memory>
 #include <optional>
 #include <queue>
 #include <random>
@@ -108,11 +112,13 @@ using namespace std::literals;
 
 #include "Utils/Memory.hpp" // Breaks order on purpose
 
+#include "Utils/BufferDiff.hpp"
 #include "Utils/Cache.hpp"
 #include "Utils/Chain.hpp"
 #include "Utils/Concurrency.hpp"
 #include "Utils/Cryptography.hpp"
 #include "Utils/CSV.hpp"
+#include "Utils/Encoding.hpp"
 #include "Utils/Entities.hpp"
 #include "Utils/Hooking.hpp"
 #include "Utils/Huffman.hpp"
@@ -120,6 +126,8 @@ using namespace std::literals;
 #include "Utils/Library.hpp"
 #include "Utils/Maths.hpp"
 #include "Utils/NamedMutex.hpp"
+#include "Utils/RateLimiter.hpp"
+#include "Utils/SpatialGrid.hpp"
 #include "Utils/String.hpp"
 #include "Utils/Thread.hpp"
 #include "Utils/Time.hpp"
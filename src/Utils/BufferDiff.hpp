@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Utils::BufferDiff
+{
+	[[nodiscard]] constexpr std::size_t ChunkCount(const std::size_t size, const std::size_t chunkSize)
+	{
+		return (size + chunkSize - 1) / chunkSize;
+	}
+
+	// Splits a buffer into fixed-size chunks, the last one may be shorter, and calls
+	// callback(index, offset, size) for each chunk of current that differs from previous.
+	// Without a previous copy (or without current data) every chunk counts as changed.
+	template <typename Callback>
+	void ForEachChangedChunk(const void* previous, const void* current, const std::size_t size, const std::size_t chunkSize, Callback&& callback)
+	{
+		const auto* before = static_cast<const char*>(previous);
+		const auto* after = static_cast<const char*>(current);
+
+		for (std::size_t index = 0, offset = 0; offset < size; ++index, offset += chunkSize)
+		{
+			const auto length = std::min(size - offset, chunkSize);
+
+			if (before && after && std::memcmp(&before[offset], &after[offset], length) == 0)
+			{
+				continue;
+			}
+
+			callback(index, offset, length);
+		}
+	}
+}
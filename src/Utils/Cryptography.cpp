@@ -8,6 +8,7 @@ namespace Utils
 		void Initialize()
 		{
 			Rand::Initialize();
+			ECC::Initialize();
 		}
 
 #pragma region Rand
@@ -51,6 +52,15 @@ namespace Utils
 
 #pragma region ECC
 
+		int ECC::SignPrng = -1;
+
+		void ECC::Initialize()
+		{
+			// Runs once on the main thread before any worker exists, so signing threads never write these globals
+			ltc_mp = ltm_desc;
+			SignPrng = register_prng(&sprng_desc);
+		}
+
 		ECC::Key ECC::GenerateKey(int bits, const std::string& entropy)
 		{
 			Key key;
@@ -100,9 +110,7 @@ namespace Utils
 			std::uint8_t buffer[512]{};
 			unsigned long length = sizeof(buffer);
 
-			ltc_mp = ltm_desc;
-			register_prng(&sprng_desc);
-			ecc_sign_hash(reinterpret_cast<const std::uint8_t*>(message.data()), message.size(), buffer, &length, nullptr, find_prng("sprng"), key.getKeyPtr());
+			ecc_sign_hash(reinterpret_cast<const std::uint8_t*>(message.data()), message.size(), buffer, &length, nullptr, SignPrng, key.getKeyPtr());
 
 			return std::string{ reinterpret_cast<char*>(buffer), length };
 		}
@@ -111,8 +119,6 @@ namespace Utils
 		{
 			if (!key.isValid()) return false;
 
-			ltc_mp = ltm_desc;
-
 			int result = 0;
 			return (ecc_verify_hash(reinterpret_cast<const std::uint8_t*>(signature.data()), signature.size(),
 				reinterpret_cast<const std::uint8_t*>(message.data()), message.size(),
@@ -238,8 +238,15 @@ namespace Utils
 			};
 
 			static Key GenerateKey(int bits, const std::string& entropy = {});
+
+			// Thread-safe, libtomcrypt globals are only set up once in Initialize
 			static std::string SignMessage(Key key, const std::string& message);
 			static bool VerifyMessage(Key key, const std::string& message, const std::string& signature);
+
+			static void Initialize();
+
+		private:
+			static int SignPrng;
 		};
 
 		class RSA
@@ -0,0 +1,185 @@
+namespace Utils::Encoding
+{
+	namespace
+	{
+		constexpr char HexCharset[] = "0123456789ABCDEF";
+
+		// Byte -> two hex digits, built once so encoding a byte is a single 16-bit copy
+		struct HexTable
+		{
+			char pairs[256][2];
+
+			constexpr HexTable() : pairs()
+			{
+				for (auto i = 0; i < 256; ++i)
+				{
+					pairs[i][0] = HexCharset[i >> 4];
+					pairs[i][1] = HexCharset[i & 0xF];
+				}
+			}
+		};
+
+		// ASCII -> value lookup for decoding, 0xFF marks invalid characters
+		template <std::size_t N>
+		struct ReverseTable
+		{
+			std::uint8_t values[256];
+
+			constexpr ReverseTable(const char (&charset)[N]) : values()
+			{
+				for (auto i = 0; i < 256; ++i) values[i] = 0xFF;
+				for (std::size_t i = 0; i < N - 1; ++i) values[static_cast<unsigned char>(charset[i])] = static_cast<std::uint8_t>(i);
+			}
+		};
+
+		constexpr HexTable HexPairs;
+		constexpr ReverseTable HexValues(HexCharset);
+
+#ifdef ENABLE_BASE64
+		constexpr char Base64Charset[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		constexpr ReverseTable Base64Values(Base64Charset);
+#endif
+
+		std::uint8_t HexValue(const char c)
+		{
+			// Accept lowercase input as well
+			if (c >= 'a' && c <= 'f') return static_cast<std::uint8_t>(c - 'a' + 10);
+			return HexValues.values[static_cast<unsigned char>(c)];
+		}
+	}
+
+	std::size_t EncodeHex(const void* data, const std::size_t size, char* output)
+	{
+		const auto* input = static_cast<const unsigned char*>(data);
+
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			std::memcpy(&output[i * 2], HexPairs.pairs[input[i]], 2);
+		}
+
+		return size * 2;
+	}
+
+	std::string EncodeHex(const std::string_view data)
+	{
+		std::string result;
+		result.resize(data.size() * 2);
+		(void)EncodeHex(data.data(), data.size(), result.data());
+
+		return result;
+	}
+
+	bool DecodeHex(const std::string_view input, std::string& output)
+	{
+		output.clear();
+
+		if (input.size() % 2)
+		{
+			return false;
+		}
+
+		output.resize(input.size() / 2);
+
+		for (std::size_t i = 0; i < output.size(); ++i)
+		{
+			const auto high = HexValue(input[i * 2]);
+			const auto low = HexValue(input[i * 2 + 1]);
+
+			if (high == 0xFF || low == 0xFF)
+			{
+				output.clear();
+				return false;
+			}
+
+			output[i] = static_cast<char>((high << 4) | low);
+		}
+
+		return true;
+	}
+
+#ifdef ENABLE_BASE64
+	std::string EncodeBase64(const void* data, const std::size_t size)
+	{
+		std::string result;
+		result.resize(((size + 2) / 3) * 4);
+
+		const auto* in = static_cast<const unsigned char*>(data);
+		auto* out = result.data();
+
+		std::size_t i = 0;
+		for (; i + 3 <= size; i += 3)
+		{
+			const auto triple = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+			*out++ = Base64Charset[(triple >> 18) & 0x3F];
+			*out++ = Base64Charset[(triple >> 12) & 0x3F];
+			*out++ = Base64Charset[(triple >> 6) & 0x3F];
+			*out++ = Base64Charset[triple & 0x3F];
+		}
+
+		if (i < size)
+		{
+			const auto remaining = size - i;
+			const auto triple = (in[i] << 16) | (remaining > 1 ? in[i + 1] << 8 : 0);
+			*out++ = Base64Charset[(triple >> 18) & 0x3F];
+			*out++ = Base64Charset[(triple >> 12) & 0x3F];
+			*out++ = remaining > 1 ? Base64Charset[(triple >> 6) & 0x3F] : '=';
+			*out++ = '=';
+		}
+
+		return result;
+	}
+
+	bool DecodeBase64(const std::string_view input, std::string& output)
+	{
+		output.clear();
+
+		if (input.size() % 4)
+		{
+			return false;
+		}
+
+		if (input.empty())
+		{
+			return true;
+		}
+
+		std::size_t padding = 0;
+		if (input[input.size() - 1] == '=') ++padding;
+		if (input[input.size() - 2] == '=') ++padding;
+
+		output.resize((input.size() / 4) * 3 - padding);
+
+		const auto* in = reinterpret_cast<const unsigned char*>(input.data());
+		auto* out = output.data();
+		const auto* end = out + output.size();
+
+		for (std::size_t i = 0; i < input.size(); i += 4)
+		{
+			const auto last = (i + 4 == input.size());
+
+			std::uint32_t quad = 0;
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				const auto c = in[i + j];
+				auto value = Base64Values.values[c];
+
+				// Padding is only valid in the trailing positions of the last quad
+				if (c == '=' && last && j >= 4 - padding) value = 0;
+				else if (value == 0xFF)
+				{
+					output.clear();
+					return false;
+				}
+
+				quad = (quad << 6) | value;
+			}
+
+			if (out < end) *out++ = static_cast<char>(quad >> 16);
+			if (out < end) *out++ = static_cast<char>(quad >> 8);
+			if (out < end) *out++ = static_cast<char>(quad);
+		}
+
+		return true;
+	}
+#endif
+}
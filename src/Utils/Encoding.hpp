@@ -0,0 +1,18 @@
+#pragma once
+
+// Table-driven hex and Base64 codecs, kept free of engine and platform dependencies
+namespace Utils::Encoding
+{
+	// Writes exactly size * 2 uppercase hex digits into output, no terminator
+	std::size_t EncodeHex(const void* data, std::size_t size, char* output);
+	[[nodiscard]] std::string EncodeHex(std::string_view data);
+
+	// Accepts both cases, returns false on malformed input
+	[[nodiscard]] bool DecodeHex(std::string_view input, std::string& output);
+
+#ifdef ENABLE_BASE64
+	// Padded output, same as libtomcrypt's base64_encode
+	[[nodiscard]] std::string EncodeBase64(const void* data, std::size_t size);
+	[[nodiscard]] bool DecodeBase64(std::string_view input, std::string& output);
+#endif
+}
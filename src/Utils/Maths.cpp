@@ -1,7 +1,7 @@
 
 namespace Utils::Maths
 {
-	float DotProduct(float v1[3], float v2[3])
+	float DotProduct(const float v1[3], const float v2[3])
 	{
 		return v1[0] * v2[0] + v1[1] * v2[1] + v1[2] * v2[2];
 	}
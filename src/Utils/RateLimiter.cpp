@@ -0,0 +1,100 @@
+
+namespace Utils
+{
+	RateLimiter::RateLimiter(std::size_t capacity, const int burst, const int interval)
+		: mask_(0), burst_(1), interval_(1), allowed_(0), dropped_(0), evicted_(0)
+	{
+		// Round up to a power of two so the slot can be masked out of the hash
+		std::size_t size = ProbeWindow;
+		while (size < capacity) size <<= 1;
+
+		this->entries_.resize(size);
+		this->mask_ = size - 1;
+
+		this->setLimits(burst, interval);
+	}
+
+	void RateLimiter::setLimits(const int burst, const int interval)
+	{
+		std::lock_guard _(this->mutex_);
+
+		this->burst_ = std::max(burst, 1);
+		this->interval_ = std::max(interval, 1);
+	}
+
+	bool RateLimiter::allow(const std::uint32_t key, const int time)
+	{
+		std::lock_guard _(this->mutex_);
+
+		auto& entry = this->find(key, time);
+
+		// Bucket is empty if the next conforming time is further ahead than the burst allows
+		if (entry.tat - time > (this->burst_ - 1) * this->interval_)
+		{
+			++this->dropped_;
+			return false;
+		}
+
+		entry.tat = std::max(entry.tat - time, 0) + time + this->interval_;
+		++this->allowed_;
+		return true;
+	}
+
+	void RateLimiter::clear()
+	{
+		std::lock_guard _(this->mutex_);
+
+		std::ranges::fill(this->entries_, Entry{});
+		this->allowed_ = 0;
+		this->dropped_ = 0;
+		this->evicted_ = 0;
+	}
+
+	bool RateLimiter::isExpired(const Entry& entry, const int time) const
+	{
+		// A full bucket carries no state worth keeping
+		return !entry.used || entry.tat - time <= 0;
+	}
+
+	RateLimiter::Entry& RateLimiter::find(const std::uint32_t key, const int time)
+	{
+		// Fibonacci hashing spreads sequential addresses across the table
+		const auto start = static_cast<std::size_t>(key * 2654435769u) & this->mask_;
+
+		Entry* freeSlot = nullptr;
+		Entry* oldest = nullptr;
+
+		for (std::size_t i = 0; i < ProbeWindow; ++i)
+		{
+			auto& entry = this->entries_[(start + i) & this->mask_];
+
+			if (entry.used && entry.key == key)
+			{
+				return entry;
+			}
+
+			if (!freeSlot && this->isExpired(entry, time))
+			{
+				freeSlot = &entry;
+			}
+
+			if (!oldest || entry.tat - oldest->tat < 0)
+			{
+				oldest = &entry;
+			}
+		}
+
+		if (!freeSlot)
+		{
+			// Window is full of live buckets, give up the one that has the least state left
+			freeSlot = oldest;
+			++this->evicted_;
+		}
+
+		freeSlot->key = key;
+		freeSlot->tat = time;
+		freeSlot->used = true;
+
+		return *freeSlot;
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+namespace Utils
+{
+	// Per-key token buckets (GCRA) in a fixed-size table. Every lookup scans a fixed
+	// probe window, so the cost per packet stays constant no matter how many sources
+	// are tracked. Entries whose bucket has refilled count as free slots. When a window
+	// is full of live entries, the one closest to refilling is evicted, so a full table
+	// never turns into a reason to reject a key.
+	class RateLimiter
+	{
+	public:
+		RateLimiter(std::size_t capacity = 4096, int burst = 1, int interval = 1000);
+
+		void setLimits(int burst, int interval);
+
+		// time is in milliseconds, only differences are used so wrapping is fine
+		[[nodiscard]] bool allow(std::uint32_t key, int time);
+		void clear();
+
+		[[nodiscard]] std::uint64_t getAllowed() const { return this->allowed_; }
+		[[nodiscard]] std::uint64_t getDropped() const { return this->dropped_; }
+		[[nodiscard]] std::uint64_t getEvicted() const { return this->evicted_; }
+
+	private:
+		static constexpr std::size_t ProbeWindow = 8;
+
+		struct Entry
+		{
+			std::uint32_t key;
+			int tat; // Theoretical arrival time of the next conforming packet
+			bool used;
+		};
+
+		mutable std::mutex mutex_;
+		std::vector<Entry> entries_;
+		std::size_t mask_;
+
+		int burst_;
+		int interval_;
+
+		std::uint64_t allowed_;
+		std::uint64_t dropped_;
+		std::uint64_t evicted_;
+
+		[[nodiscard]] bool isExpired(const Entry& entry, int time) const;
+		[[nodiscard]] Entry& find(std::uint32_t key, int time);
+	};
+}
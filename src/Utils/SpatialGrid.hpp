@@ -0,0 +1,136 @@
+#pragma once
+
+namespace Utils
+{
+	// Uniform grid over the XY plane for bucketing static geometry. Items go into the cell
+	// holding their center and every cell tracks the 3D bounds of what it holds, so queries
+	// can reject whole cells against a distance sphere and a caller supplied visibility test.
+	template <typename T>
+	class SpatialGrid
+	{
+	public:
+		struct Cell
+		{
+			float mins[3];
+			float maxs[3];
+			T items;
+		};
+
+		SpatialGrid() : origin_{}, cellSize_(0.0f), dims_{}
+		{
+		}
+
+		// Lays out cells covering mins..maxs on X and Y, no cell is smaller than minCellSize
+		void reset(const float* mins, const float* maxs, const float minCellSize, const int maxCellsPerAxis)
+		{
+			this->clear();
+
+			if (mins[0] > maxs[0] || mins[1] > maxs[1])
+			{
+				return;
+			}
+
+			this->cellSize_ = std::max(minCellSize, std::max(maxs[0] - mins[0], maxs[1] - mins[1]) / maxCellsPerAxis);
+			for (auto axis = 0; axis < 2; ++axis)
+			{
+				this->origin_[axis] = mins[axis];
+				this->dims_[axis] = std::clamp(static_cast<int>((maxs[axis] - mins[axis]) / this->cellSize_) + 1, 1, maxCellsPerAxis);
+			}
+
+			this->cells_.resize(static_cast<std::size_t>(this->dims_[0]) * this->dims_[1]);
+			for (auto& cell : this->cells_)
+			{
+				std::fill_n(cell.mins, 3, std::numeric_limits<float>::max());
+				std::fill_n(cell.maxs, 3, std::numeric_limits<float>::lowest());
+			}
+		}
+
+		void clear()
+		{
+			this->cells_.clear();
+			this->cellSize_ = 0.0f;
+			this->dims_[0] = this->dims_[1] = 0;
+		}
+
+		[[nodiscard]] bool empty() const { return this->cells_.empty(); }
+		[[nodiscard]] std::size_t size() const { return this->cells_.size(); }
+
+		// Points outside the grid are clamped into the border cells
+		[[nodiscard]] Cell& cellAt(const float* point)
+		{
+			return this->cells_[this->index(point[1], 1) * this->dims_[0] + this->index(point[0], 0)];
+		}
+
+		static void Grow(Cell& cell, const float* point)
+		{
+			for (auto axis = 0; axis < 3; ++axis)
+			{
+				cell.mins[axis] = std::min(cell.mins[axis], point[axis]);
+				cell.maxs[axis] = std::max(cell.maxs[axis], point[axis]);
+			}
+		}
+
+		// Calls callback(cell, inside) for every filled cell whose bounding sphere reaches into
+		// the query sphere and passes visible(center, radius). inside is set when the whole
+		// cell lies within the query sphere, so its items need no further distance checks.
+		template <typename Visible, typename Callback>
+		void query(const float* origin, const float radius, Visible&& visible, Callback&& callback)
+		{
+			if (this->cells_.empty())
+			{
+				return;
+			}
+
+			const auto x0 = this->index(origin[0] - radius, 0);
+			const auto x1 = this->index(origin[0] + radius, 0);
+			const auto y0 = this->index(origin[1] - radius, 1);
+			const auto y1 = this->index(origin[1] + radius, 1);
+
+			for (auto y = y0; y <= y1; ++y)
+			{
+				for (auto x = x0; x <= x1; ++x)
+				{
+					auto& cell = this->cells_[y * this->dims_[0] + x];
+					if (cell.mins[0] > cell.maxs[0])
+					{
+						continue;
+					}
+
+					float center[3];
+					auto cellSqrRadius = 0.0f;
+					auto sqrDistance = 0.0f;
+					for (auto axis = 0; axis < 3; ++axis)
+					{
+						center[axis] = (cell.mins[axis] + cell.maxs[axis]) * 0.5f;
+
+						const auto extent = (cell.maxs[axis] - cell.mins[axis]) * 0.5f;
+						const auto delta = origin[axis] - center[axis];
+						cellSqrRadius += extent * extent;
+						sqrDistance += delta * delta;
+					}
+
+					const auto cellRadius = std::sqrt(cellSqrRadius);
+					const auto distance = std::sqrt(sqrDistance);
+
+					if (distance - cellRadius > radius || !visible(center, cellRadius))
+					{
+						continue;
+					}
+
+					callback(cell, distance + cellRadius <= radius);
+				}
+			}
+		}
+
+	private:
+		float origin_[2];
+		float cellSize_;
+		int dims_[2];
+		std::vector<Cell> cells_;
+
+		[[nodiscard]] int index(const float value, const int axis) const
+		{
+			return std::clamp(static_cast<int>((value - this->origin_[axis]) / this->cellSize_), 0, this->dims_[axis] - 1);
+		}
+	};
+}
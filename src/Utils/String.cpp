@@ -52,16 +52,30 @@ namespace Utils::String
 
 	std::string DumpHex(const std::string& data, const std::string& separator)
 	{
+		if (data.empty())
+		{
+			return {};
+		}
+
 		std::string result;
 
+		if (separator.empty())
+		{
+			return Encoding::EncodeHex(data);
+		}
+
+		result.resize(data.size() * 2 + (data.size() - 1) * separator.size());
+
+		auto* output = result.data();
 		for (std::size_t i = 0; i < data.size(); ++i)
 		{
 			if (i > 0)
 			{
-				result.append(separator);
+				std::memcpy(output, separator.data(), separator.size());
+				output += separator.size();
 			}
 
-			result.append(VA("%02X", data[i] & 0xFF));
+			output += Encoding::EncodeHex(&data[i], 1, output);
 		}
 
 		return result;
@@ -224,12 +238,7 @@ namespace Utils::String
 	// Encodes a given string in Base64
 	std::string EncodeBase64(const char* input, const unsigned long inputSize)
 	{
-		unsigned long outlen = long(inputSize + (inputSize / 3.0) + 16);
-		unsigned char* outbuf = new unsigned char[outlen]; //Reserve output memory
-		base64_encode(reinterpret_cast<unsigned char*>(const_cast<char*>(input)), inputSize, outbuf, &outlen);
-		std::string ret(reinterpret_cast<char*>(outbuf), outlen);
-		delete[] outbuf;
-		return ret;
+		return Encoding::EncodeBase64(input, inputSize);
 	}
 
 	// Encodes a given string in Base64
@@ -0,0 +1,99 @@
+#include "Test.hpp"
+
+namespace
+{
+	// Same layout as the client stat buffer in Stats
+	constexpr std::size_t BufferSize = 8192;
+	constexpr std::size_t ChunkSize = 1240;
+
+	struct Transfer
+	{
+		std::vector<std::size_t> chunks;
+		std::vector<char> server = std::vector<char>(BufferSize);
+
+		// Mirrors the client: send the chunks that differ, the server copies each one into place
+		void send(const std::vector<char>* previous, const std::vector<char>& current)
+		{
+			this->chunks.clear();
+
+			Utils::BufferDiff::ForEachChangedChunk(previous ? previous->data() : nullptr, current.data(), current.size(), ChunkSize, [this, &current](const std::size_t index, const std::size_t offset, const std::size_t size)
+			{
+				CHECK(offset == index * ChunkSize);
+				CHECK(offset + size <= current.size());
+
+				this->chunks.push_back(index);
+				std::memcpy(&this->server[offset], &current[offset], size);
+			});
+		}
+	};
+
+	void TestChunkLayout()
+	{
+		CHECK(Utils::BufferDiff::ChunkCount(BufferSize, ChunkSize) == 7);
+		CHECK(Utils::BufferDiff::ChunkCount(0, ChunkSize) == 0);
+		CHECK(Utils::BufferDiff::ChunkCount(ChunkSize, ChunkSize) == 1);
+
+		std::vector<std::size_t> sizes;
+		Utils::BufferDiff::ForEachChangedChunk(nullptr, nullptr, BufferSize, ChunkSize, [&sizes](std::size_t, std::size_t, const std::size_t size)
+		{
+			sizes.push_back(size);
+		});
+
+		// Without any data every chunk is reported, the last one is short
+		CHECK(sizes.size() == 7);
+		CHECK(sizes.front() == ChunkSize);
+		CHECK(sizes.back() == BufferSize - 6 * ChunkSize);
+	}
+
+	void TestRoundTrip()
+	{
+		std::mt19937 random(1234);
+		std::vector<char> stats(BufferSize);
+		for (auto& byte : stats) byte = static_cast<char>(random());
+
+		Transfer transfer;
+
+		// First send has nothing to compare against
+		transfer.send(nullptr, stats);
+		CHECK(transfer.chunks.size() == 7);
+		CHECK(transfer.server == stats);
+
+		for (auto round = 0; round < 1000; ++round)
+		{
+			auto previous = stats;
+
+			std::set<std::size_t> touched;
+			const auto edits = random() % 4;
+			for (std::size_t i = 0; i < edits; ++i)
+			{
+				const auto offset = random() % BufferSize;
+				stats[offset] = static_cast<char>(stats[offset] + 1 + random() % 255);
+				touched.insert(offset / ChunkSize);
+			}
+
+			transfer.send(&previous, stats);
+
+			// Only the touched chunks went out, and the server copy matches again
+			CHECK(std::set<std::size_t>(transfer.chunks.begin(), transfer.chunks.end()) == touched);
+			CHECK(transfer.server == stats);
+		}
+
+		// Writes on the chunk boundaries land in the right chunk
+		auto previous = stats;
+		stats[ChunkSize - 1] ^= 1;
+		stats[ChunkSize] ^= 1;
+		stats[BufferSize - 1] ^= 1;
+
+		transfer.send(&previous, stats);
+		CHECK((transfer.chunks == std::vector<std::size_t>{ 0, 1, 6 }));
+		CHECK(transfer.server == stats);
+	}
+}
+
+int main()
+{
+	TestChunkLayout();
+	TestRoundTrip();
+
+	return Test::Failures ? 1 : 0;
+}
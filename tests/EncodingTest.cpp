@@ -0,0 +1,102 @@
+#include "Test.hpp"
+
+namespace
+{
+	std::string AllBytes()
+	{
+		std::string data;
+		for (auto i = 0; i < 256; ++i) data.push_back(static_cast<char>(i));
+		return data;
+	}
+
+	void TestHex()
+	{
+		CHECK(Utils::Encoding::EncodeHex("") == "");
+		CHECK(Utils::Encoding::EncodeHex(std::string_view("\x00\x7F\xAB\xFF", 4)) == "007FABFF");
+
+		char buffer[4];
+		CHECK(Utils::Encoding::EncodeHex("\x12\x34", 2, buffer) == 4);
+		CHECK(std::string_view(buffer, 4) == "1234");
+
+		std::string decoded;
+		CHECK(Utils::Encoding::DecodeHex("007FABFF", decoded));
+		CHECK(decoded == std::string_view("\x00\x7F\xAB\xFF", 4));
+
+		// Lowercase input decodes to the same bytes
+		CHECK(Utils::Encoding::DecodeHex("007fabff", decoded));
+		CHECK(decoded == std::string_view("\x00\x7F\xAB\xFF", 4));
+
+		const auto data = AllBytes();
+		CHECK(Utils::Encoding::DecodeHex(Utils::Encoding::EncodeHex(data), decoded));
+		CHECK(decoded == data);
+	}
+
+	void TestHexMalformed()
+	{
+		std::string decoded = "stale";
+		CHECK(!Utils::Encoding::DecodeHex("ABC", decoded));
+		CHECK(decoded.empty());
+
+		CHECK(!Utils::Encoding::DecodeHex("GG", decoded));
+		CHECK(!Utils::Encoding::DecodeHex("0x", decoded));
+		CHECK(!Utils::Encoding::DecodeHex(std::string_view("A\0", 2), decoded));
+		CHECK(decoded.empty());
+
+		CHECK(Utils::Encoding::DecodeHex("", decoded));
+		CHECK(decoded.empty());
+	}
+
+	void TestBase64()
+	{
+		// RFC 4648 test vectors
+		const std::pair<std::string_view, std::string_view> vectors[] =
+		{
+			{ "", "" },
+			{ "f", "Zg==" },
+			{ "fo", "Zm8=" },
+			{ "foo", "Zm9v" },
+			{ "foob", "Zm9vYg==" },
+			{ "fooba", "Zm9vYmE=" },
+			{ "foobar", "Zm9vYmFy" },
+		};
+
+		for (const auto& [plain, encoded] : vectors)
+		{
+			CHECK(Utils::Encoding::EncodeBase64(plain.data(), plain.size()) == encoded);
+
+			std::string decoded;
+			CHECK(Utils::Encoding::DecodeBase64(encoded, decoded));
+			CHECK(decoded == plain);
+		}
+
+		auto data = AllBytes();
+		for (std::size_t size = 0; size <= data.size(); ++size)
+		{
+			std::string decoded;
+			CHECK(Utils::Encoding::DecodeBase64(Utils::Encoding::EncodeBase64(data.data(), size), decoded));
+			CHECK(decoded == std::string_view(data.data(), size));
+		}
+	}
+
+	void TestBase64Malformed()
+	{
+		std::string decoded = "stale";
+		CHECK(!Utils::Encoding::DecodeBase64("Zm9", decoded));
+		CHECK(decoded.empty());
+
+		CHECK(!Utils::Encoding::DecodeBase64("Zm9v!A==", decoded));
+		CHECK(!Utils::Encoding::DecodeBase64("Z=9v", decoded));
+		CHECK(!Utils::Encoding::DecodeBase64("Zg==Zm9v", decoded));
+		CHECK(decoded.empty());
+	}
+}
+
+int main()
+{
+	TestHex();
+	TestHexMalformed();
+	TestBase64();
+	TestBase64Malformed();
+
+	return Test::Failures ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+// Subset of STDInclude.hpp needed by the sources under test
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <ranges>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Utils/BufferDiff.hpp"
+#include "Utils/Encoding.hpp"
+#include "Utils/RateLimiter.hpp"
+#include "Utils/SpatialGrid.hpp"
@@ -0,0 +1,105 @@
+#include "Test.hpp"
+
+namespace
+{
+	void TestBurstAndInterval()
+	{
+		Utils::RateLimiter limiter(64, 3, 100);
+
+		// A full bucket allows the whole burst, then nothing until it refills
+		CHECK(limiter.allow(1, 0));
+		CHECK(limiter.allow(1, 0));
+		CHECK(limiter.allow(1, 0));
+		CHECK(!limiter.allow(1, 0));
+		CHECK(!limiter.allow(1, 99));
+
+		// One interval later exactly one more token is available
+		CHECK(limiter.allow(1, 100));
+		CHECK(!limiter.allow(1, 100));
+
+		// Long idle periods refill the bucket, but never beyond the burst
+		CHECK(limiter.allow(1, 10000));
+		CHECK(limiter.allow(1, 10000));
+		CHECK(limiter.allow(1, 10000));
+		CHECK(!limiter.allow(1, 10000));
+
+		CHECK(limiter.getAllowed() == 7);
+		CHECK(limiter.getDropped() == 4);
+		CHECK(limiter.getEvicted() == 0);
+	}
+
+	void TestKeysAreIndependent()
+	{
+		Utils::RateLimiter limiter(64, 1, 1000);
+
+		CHECK(limiter.allow(1, 0));
+		CHECK(!limiter.allow(1, 0));
+
+		for (std::uint32_t key = 2; key < 32; ++key)
+		{
+			CHECK(limiter.allow(key, 0));
+		}
+
+		CHECK(!limiter.allow(1, 500));
+		CHECK(limiter.allow(1, 1000));
+	}
+
+	void TestFullTableEvicts()
+	{
+		// The smallest table is a single probe window, so every key competes for the same slots
+		Utils::RateLimiter limiter(1, 1, 1000);
+
+		for (std::uint32_t key = 0; key < 8; ++key)
+		{
+			CHECK(limiter.allow(key, static_cast<int>(key)));
+		}
+
+		CHECK(limiter.getEvicted() == 0);
+
+		// A new key is never rejected because the table is full
+		for (std::uint32_t key = 100; key < 200; ++key)
+		{
+			CHECK(limiter.allow(key, 10));
+		}
+
+		CHECK(limiter.getEvicted() == 100);
+		CHECK(limiter.getDropped() == 0);
+
+		// Buckets that refilled are reused without counting as evictions
+		CHECK(limiter.allow(1000, 5000));
+		CHECK(limiter.getEvicted() == 100);
+	}
+
+	void TestLimitsAndClear()
+	{
+		Utils::RateLimiter limiter(64, 1, 1000);
+
+		CHECK(limiter.allow(7, 0));
+		CHECK(!limiter.allow(7, 0));
+
+		limiter.setLimits(4, 1000);
+		CHECK(limiter.allow(7, 0));
+
+		// Non-positive limits are clamped instead of blocking everything
+		limiter.setLimits(0, 0);
+		CHECK(limiter.allow(8, 0));
+
+		limiter.clear();
+		CHECK(limiter.getAllowed() == 0);
+		CHECK(limiter.getDropped() == 0);
+		CHECK(limiter.getEvicted() == 0);
+
+		limiter.setLimits(1, 1000);
+		CHECK(limiter.allow(7, 0));
+	}
+}
+
+int main()
+{
+	TestBurstAndInterval();
+	TestKeysAreIndependent();
+	TestFullTableEvicts();
+	TestLimitsAndClear();
+
+	return Test::Failures ? 1 : 0;
+}
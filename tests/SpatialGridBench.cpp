@@ -0,0 +1,119 @@
+// Compares the per-frame work of the clip map debug draw with and without the grid on a
+// synthetic map. Not part of ctest, run it by hand: SpatialGridBench [triangles] [queries]
+#include "Test.hpp"
+
+namespace
+{
+	struct Items
+	{
+		std::vector<float> triangles; // 9 floats per triangle
+	};
+
+	using Grid = Utils::SpatialGrid<Items>;
+	using Clock = std::chrono::steady_clock;
+
+	float SqrDistance(const float* a, const float* b)
+	{
+		const float delta[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+		return delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+	}
+
+	bool InRange(const float* origin, const float* triangle, const float sqrRadius)
+	{
+		return SqrDistance(origin, triangle) <= sqrRadius && SqrDistance(origin, triangle + 3) <= sqrRadius && SqrDistance(origin, triangle + 6) <= sqrRadius;
+	}
+}
+
+int main(const int argc, char** argv)
+{
+	const auto triangleCount = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 1000000;
+	const auto queryCount = argc > 2 ? std::atoi(argv[2]) : 200;
+
+	constexpr auto mapExtent = 16384.0f;
+	constexpr auto drawDistance = 1000.0f;
+	constexpr auto sqrDrawDistance = drawDistance * drawDistance;
+
+	// Small triangles spread over a 32k x 32k map, like terrain and brush faces
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> horizontal(-mapExtent, mapExtent);
+	std::uniform_real_distribution<float> vertical(-512.0f, 512.0f);
+	std::uniform_real_distribution<float> offset(-64.0f, 64.0f);
+
+	std::vector<float> triangles(triangleCount * 9);
+	for (std::size_t i = 0; i < triangleCount; ++i)
+	{
+		const float center[3] = { horizontal(random), horizontal(random), vertical(random) };
+		for (auto corner = 0; corner < 3; ++corner)
+		{
+			for (auto axis = 0; axis < 3; ++axis)
+			{
+				triangles[i * 9 + corner * 3 + axis] = center[axis] + offset(random);
+			}
+		}
+	}
+
+	const auto buildStart = Clock::now();
+
+	Grid grid;
+	const float mins[2] = { -mapExtent - 64.0f, -mapExtent - 64.0f };
+	const float maxs[2] = { mapExtent + 64.0f, mapExtent + 64.0f };
+	grid.reset(mins, maxs, 512.0f, 64);
+
+	for (std::size_t i = 0; i < triangleCount; ++i)
+	{
+		const auto* triangle = &triangles[i * 9];
+		const float centroid[3] =
+		{
+			(triangle[0] + triangle[3] + triangle[6]) / 3.0f,
+			(triangle[1] + triangle[4] + triangle[7]) / 3.0f,
+			(triangle[2] + triangle[5] + triangle[8]) / 3.0f,
+		};
+
+		auto& cell = grid.cellAt(centroid);
+		cell.items.triangles.insert(cell.items.triangles.end(), triangle, triangle + 9);
+		for (auto corner = 0; corner < 3; ++corner)
+		{
+			Grid::Grow(cell, triangle + corner * 3);
+		}
+	}
+
+	const auto buildTime = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+
+	std::vector<std::array<float, 3>> origins(queryCount);
+	for (auto& origin : origins)
+	{
+		origin = { horizontal(random), horizontal(random), 0.0f };
+	}
+
+	std::size_t bruteDrawn = 0;
+	const auto bruteStart = Clock::now();
+	for (const auto& origin : origins)
+	{
+		for (std::size_t i = 0; i < triangleCount; ++i)
+		{
+			bruteDrawn += InRange(origin.data(), &triangles[i * 9], sqrDrawDistance);
+		}
+	}
+	const auto bruteTime = std::chrono::duration<double, std::micro>(Clock::now() - bruteStart).count() / queryCount;
+
+	std::size_t gridDrawn = 0;
+	const auto gridStart = Clock::now();
+	for (const auto& origin : origins)
+	{
+		grid.query(origin.data(), drawDistance, [](const float*, float) { return true; }, [&](Grid::Cell& cell, const bool inside)
+		{
+			const auto& cellTriangles = cell.items.triangles;
+			for (std::size_t i = 0; i < cellTriangles.size(); i += 9)
+			{
+				gridDrawn += inside || InRange(origin.data(), &cellTriangles[i], sqrDrawDistance);
+			}
+		});
+	}
+	const auto gridTime = std::chrono::duration<double, std::micro>(Clock::now() - gridStart).count() / queryCount;
+
+	std::printf("triangles: %zu, cells: %zu, build: %.1f ms\n", triangleCount, grid.size(), buildTime);
+	std::printf("brute force: %.1f us/frame, grid: %.1f us/frame, speedup: %.1fx\n", bruteTime, gridTime, bruteTime / gridTime);
+	std::printf("drawn per frame: %.1f (brute force) / %.1f (grid)\n", static_cast<double>(bruteDrawn) / queryCount, static_cast<double>(gridDrawn) / queryCount);
+
+	return bruteDrawn == gridDrawn ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+#include "Test.hpp"
+
+namespace
+{
+	using Grid = Utils::SpatialGrid<std::vector<unsigned int>>;
+
+	float SqrDistance(const float* a, const float* b)
+	{
+		const float delta[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+		return delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+	}
+
+	std::vector<std::array<float, 3>> RandomPoints(std::mt19937& random, const std::size_t count, const float extent)
+	{
+		std::uniform_real_distribution<float> horizontal(-extent, extent);
+		std::uniform_real_distribution<float> vertical(-1024.0f, 1024.0f);
+
+		std::vector<std::array<float, 3>> points(count);
+		for (auto& point : points)
+		{
+			point = { horizontal(random), horizontal(random), vertical(random) };
+		}
+
+		return points;
+	}
+
+	void Build(Grid& grid, const std::vector<std::array<float, 3>>& points)
+	{
+		float mins[2] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		float maxs[2] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+		for (const auto& point : points)
+		{
+			for (auto axis = 0; axis < 2; ++axis)
+			{
+				mins[axis] = std::min(mins[axis], point[axis]);
+				maxs[axis] = std::max(maxs[axis], point[axis]);
+			}
+		}
+
+		grid.reset(mins, maxs, 512.0f, 64);
+		for (unsigned int i = 0; i < points.size(); ++i)
+		{
+			auto& cell = grid.cellAt(points[i].data());
+			cell.items.push_back(i);
+			Grid::Grow(cell, points[i].data());
+		}
+	}
+
+	void TestEmpty()
+	{
+		Grid grid;
+		CHECK(grid.empty());
+
+		// Inverted bounds leave the grid empty, queries visit nothing
+		const float mins[2] = { 1.0f, 1.0f };
+		const float maxs[2] = { 0.0f, 0.0f };
+		grid.reset(mins, maxs, 512.0f, 64);
+		CHECK(grid.empty());
+
+		auto visited = 0;
+		const float origin[3] = {};
+		grid.query(origin, 1000.0f, [](const float*, float) { return true; }, [&visited](Grid::Cell&, bool) { ++visited; });
+		CHECK(visited == 0);
+	}
+
+	void TestLayout()
+	{
+		std::mt19937 random(42);
+		const auto points = RandomPoints(random, 1000, 100000.0f);
+
+		Grid grid;
+		Build(grid, points);
+
+		// Large maps are capped at 64 cells per axis, small ones by the minimum cell size
+		CHECK(grid.size() <= 64 * 64);
+		CHECK(grid.size() > 32 * 32);
+
+		const float mins[2] = { 0.0f, 0.0f };
+		const float maxs[2] = { 1000.0f, 100.0f };
+		grid.reset(mins, maxs, 512.0f, 64);
+		CHECK(grid.size() == 2);
+
+		// Points outside the bounds end up in the border cells
+		const float outside[3] = { -5000.0f, 5000.0f, 0.0f };
+		const float corner[3] = { 0.0f, 0.0f, 0.0f };
+		CHECK(&grid.cellAt(outside) == &grid.cellAt(corner));
+	}
+
+	void TestQueryMatchesBruteForce()
+	{
+		std::mt19937 random(7);
+		const auto points = RandomPoints(random, 20000, 16384.0f);
+
+		Grid grid;
+		Build(grid, points);
+
+		std::uniform_real_distribution<float> position(-20000.0f, 20000.0f);
+		std::uniform_real_distribution<float> radii(100.0f, 6000.0f);
+
+		for (auto i = 0; i < 200; ++i)
+		{
+			const float origin[3] = { position(random), position(random), 0.0f };
+			const auto radius = radii(random);
+			const auto sqrRadius = radius * radius;
+
+			std::set<unsigned int> found;
+			grid.query(origin, radius, [](const float*, float) { return true; }, [&](Grid::Cell& cell, const bool inside)
+			{
+				for (const auto index : cell.items)
+				{
+					// A cell reported as inside must not hold anything out of range
+					if (inside)
+					{
+						CHECK(SqrDistance(origin, points[index].data()) <= sqrRadius * 1.0001f);
+					}
+
+					if (SqrDistance(origin, points[index].data()) <= sqrRadius)
+					{
+						found.insert(index);
+					}
+				}
+			});
+
+			std::set<unsigned int> expected;
+			for (unsigned int j = 0; j < points.size(); ++j)
+			{
+				if (SqrDistance(origin, points[j].data()) <= sqrRadius)
+				{
+					expected.insert(j);
+				}
+			}
+
+			CHECK(found == expected);
+		}
+	}
+
+	void TestVisibilityFilter()
+	{
+		std::mt19937 random(99);
+		const auto points = RandomPoints(random, 5000, 8192.0f);
+
+		Grid grid;
+		Build(grid, points);
+
+		// Only cells centered on the positive X side pass, and only those reach the callback
+		auto accepted = 0;
+		auto visited = 0;
+		const float origin[3] = {};
+		grid.query(origin, 100000.0f, [&accepted](const float* center, float)
+		{
+			const auto visible = center[0] >= 0.0f;
+			accepted += visible;
+			return visible;
+		}, [&visited](Grid::Cell& cell, bool)
+		{
+			CHECK(cell.mins[0] + cell.maxs[0] >= 0.0f);
+			++visited;
+		});
+
+		CHECK(visited > 0);
+		CHECK(visited == accepted);
+
+		visited = 0;
+		grid.query(origin, 100000.0f, [](const float*, float) { return false; }, [&visited](Grid::Cell&, bool) { ++visited; });
+		CHECK(visited == 0);
+	}
+}
+
+int main()
+{
+	TestEmpty();
+	TestLayout();
+	TestQueryMatchesBruteForce();
+	TestVisibilityFilter();
+
+	return Test::Failures ? 1 : 0;
+}
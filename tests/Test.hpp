@@ -0,0 +1,17 @@
+#pragma once
+
+namespace Test
+{
+	inline int Failures = 0;
+
+	inline void Check(const bool condition, const char* expression, const char* file, const int line)
+	{
+		if (!condition)
+		{
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+			++Failures;
+		}
+	}
+}
+
+#define CHECK(x) Test::Check(static_cast<bool>(x), #x, __FILE__, __LINE__)